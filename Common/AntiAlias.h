@@ -0,0 +1,267 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <glad/glad.h>
+
+#include "ShaderDefines.h"
+#include "ShaderProgram.h"
+
+// Antisserrilhado escolhido por FCG_AA:
+//   none       nada (padrão)
+//   msaa2/4/8  desenha num FBO multiamostrado e resolve para a janela
+//   analitico  cobertura calculada no fragment shader pela distância às arestas
+//              (só para polígonos de cor sólida; usa mistura alfa)
+//
+// Uso no loop:
+//   AntiAliasing aa;                                 // lê FCG_AA
+//   if (aa.mode() == AAMode::Analytic) prog = aa.analyticProgram(vsSrc);
+//   (com vertexColor = true a cor vem do "out vec4 vColor" do vertex shader,
+//   e não do uniform inputColor)
+//   aa.beginFrame(w, h);  glClear(...);  ...desenho...;  aa.endFrame();
+//   (endFrame(fbo) resolve o MSAA em outro framebuffer, como uma StaticLayer)
+//   regressionFrame(window);  glfwSwapBuffers(window);
+//
+// Cada modo grava a regressão com o próprio nome (aaRegressionName), então o
+// regressao.csv guarda o custo por quadro de cada modo lado a lado.
+enum class AAMode
+{
+    None,
+    MSAA2,
+    MSAA4,
+    MSAA8,
+    Analytic
+};
+
+inline const char *aaModeName(AAMode mode)
+{
+    switch (mode)
+    {
+    case AAMode::MSAA2: return "msaa2";
+    case AAMode::MSAA4: return "msaa4";
+    case AAMode::MSAA8: return "msaa8";
+    case AAMode::Analytic: return "analitico";
+    default: return "none";
+    }
+}
+
+inline AAMode aaModeFromEnv()
+{
+    const char *v = std::getenv("FCG_AA");
+    if (!v)
+        return AAMode::None;
+    for (AAMode m : {AAMode::MSAA2, AAMode::MSAA4, AAMode::MSAA8, AAMode::Analytic})
+        if (std::strcmp(v, aaModeName(m)) == 0)
+            return m;
+    return AAMode::None;
+}
+
+// Nome do programa na regressão: "Lista1_Exercicio9" ou "Lista1_Exercicio9_msaa4"
+inline std::string aaRegressionName(const char *base)
+{
+    AAMode mode = aaModeFromEnv();
+    return mode == AAMode::None ? std::string(base) : std::string(base) + "_" + aaModeName(mode);
+}
+
+// Arestas que recebem antisserrilhado analítico, por triângulo: bit i = aresta
+// oposta ao vértice i. Arestas internas de uma malha ficam de fora, senão o
+// esmaecimento aparece como uma costura. Um valor para primitivas pares e
+// outro para ímpares (retângulos de dois triângulos alternam a diagonal).
+const int AA_EDGES_ALL = 7;      // triângulos soltos
+const int AA_EDGES_FAN = 1;      // leque (centro, borda i, borda i+1): só a borda
+const int AA_EDGES_QUAD_EVEN = 5; // (a, b, c) de um retângulo (a, b, c), (a, c, d)
+const int AA_EDGES_QUAD_ODD = 3;  // (a, c, d)
+
+class AntiAliasing
+{
+public:
+    explicit AntiAliasing(AAMode m = aaModeFromEnv()) : current(m) {}
+
+    AAMode mode() const { return current; }
+
+    // Mesmo vertex shader do exercício + geometry/fragment shader de cobertura
+    GLuint analyticProgram(const GLchar *vertexSrc, bool vertexColor = false)
+    {
+        const char *define = vertexColor ? "VERTEX_COLOR" : nullptr;
+        GLuint stages[] = {compileShader(GL_VERTEX_SHADER, vertexSrc),
+                           compileShader(GL_GEOMETRY_SHADER, glslWithDefine(geometrySrc, define).c_str()),
+                           compileShader(GL_FRAGMENT_SHADER, glslWithDefine(fragmentSrc, define).c_str())};
+        GLuint program = linkStages(stages, 3, "AntiAlias");
+        if (!program)
+            return 0;
+        programs.push_back(program);
+        setEdgeMasks(program, AA_EDGES_ALL, AA_EDGES_ALL);
+        return program;
+    }
+
+    // Preserva o programa em uso
+    void setEdgeMasks(GLuint program, int even, int odd)
+    {
+        GLint previous;
+        glGetIntegerv(GL_CURRENT_PROGRAM, &previous);
+        glUseProgram(program);
+        glUniform2i(glGetUniformLocation(program, "edgeMasks"), even, odd);
+        glUseProgram(previous);
+    }
+
+    // Chamar antes do glClear
+    void beginFrame(int w, int h)
+    {
+        width = w;
+        height = h;
+        if (current == AAMode::Analytic)
+        {
+            GLint previous;
+            glGetIntegerv(GL_CURRENT_PROGRAM, &previous);
+            for (GLuint p : programs)
+            {
+                glUseProgram(p);
+                glUniform2f(glGetUniformLocation(p, "viewport"), static_cast<float>(w), static_cast<float>(h));
+            }
+            glUseProgram(previous);
+            glEnable(GL_BLEND);
+            glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        }
+        else if (current != AAMode::None)
+        {
+            ensureFramebuffer(w, h);
+            glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+        }
+    }
+
+    // Chamar depois do desenho e antes de regressionFrame e da troca de buffers;
+    // target é o framebuffer que recebe o resultado (a janela, por padrão)
+    void endFrame(GLuint target = 0)
+    {
+        if (current == AAMode::Analytic)
+        {
+            glDisable(GL_BLEND);
+        }
+        else if (current != AAMode::None && fbo)
+        {
+            glBindFramebuffer(GL_READ_FRAMEBUFFER, fbo);
+            glBindFramebuffer(GL_DRAW_FRAMEBUFFER, target);
+            glBlitFramebuffer(0, 0, width, height, 0, 0, width, height, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+            glBindFramebuffer(GL_FRAMEBUFFER, target);
+        }
+    }
+
+    void release()
+    {
+        for (GLuint p : programs)
+            glDeleteProgram(p);
+        programs.clear();
+        glDeleteFramebuffers(1, &fbo);
+        glDeleteRenderbuffers(1, &colorBuffer);
+        glDeleteRenderbuffers(1, &depthBuffer);
+        fbo = colorBuffer = depthBuffer = 0;
+    }
+
+private:
+    int samples() const
+    {
+        int wanted = current == AAMode::MSAA2 ? 2 : current == AAMode::MSAA4 ? 4 : 8;
+        GLint maxSamples = 0;
+        glGetIntegerv(GL_MAX_SAMPLES, &maxSamples);
+        return std::min(wanted, static_cast<int>(maxSamples));
+    }
+
+    // Recria o FBO quando a janela muda de tamanho; tem profundidade, como a
+    // janela, para quem desenha com GL_DEPTH_TEST
+    void ensureFramebuffer(int w, int h)
+    {
+        if (fbo && w == fbWidth && h == fbHeight)
+            return;
+        if (!fbo)
+        {
+            glGenFramebuffers(1, &fbo);
+            glGenRenderbuffers(1, &colorBuffer);
+            glGenRenderbuffers(1, &depthBuffer);
+        }
+        glBindRenderbuffer(GL_RENDERBUFFER, colorBuffer);
+        glRenderbufferStorageMultisample(GL_RENDERBUFFER, samples(), GL_RGBA8, w, h);
+        glBindRenderbuffer(GL_RENDERBUFFER, depthBuffer);
+        glRenderbufferStorageMultisample(GL_RENDERBUFFER, samples(), GL_DEPTH_COMPONENT24, w, h);
+        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+        glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, colorBuffer);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depthBuffer);
+        if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+        {
+            std::cerr << "AntiAlias: FBO " << aaModeName(current) << " incompleto, desligando" << std::endl;
+            current = AAMode::None;
+        }
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        fbWidth = w;
+        fbHeight = h;
+    }
+
+    // Empurra cada aresta de borda 1 px para fora e passa ao fragment shader a
+    // distância (em px) de cada aresta. Em coordenadas baricêntricas o vértice
+    // i deslocado tem lambda_j = -d_j/h_j nas outras duas arestas, onde h_j é a
+    // altura do triângulo relativa à aresta j.
+    static constexpr const GLchar *geometrySrc = R"(
+ #version 400
+ layout (triangles) in;
+ layout (triangle_strip, max_vertices = 3) out;
+ uniform vec2 viewport;
+ uniform ivec2 edgeMasks;
+ noperspective out vec3 edgeDistance;
+ #ifdef VERTEX_COLOR
+ in vec4 vColor[];
+ flat out vec4 triangleColor;
+ #endif
+ void main()
+ {
+	 vec2 p[3];
+	 for (int i = 0; i < 3; ++i)
+		 p[i] = gl_in[i].gl_Position.xy / gl_in[i].gl_Position.w * 0.5 * viewport;
+	 float area = abs((p[1].x - p[0].x) * (p[2].y - p[0].y) - (p[1].y - p[0].y) * (p[2].x - p[0].x));
+	 vec3 h = max(vec3(area / length(p[2] - p[1]), area / length(p[2] - p[0]), area / length(p[1] - p[0])), vec3(1e-3));
+	 int mask = (gl_PrimitiveIDIn % 2 == 0) ? edgeMasks.x : edgeMasks.y;
+	 vec3 border = vec3((mask & 1) != 0, (mask & 2) != 0, (mask & 4) != 0);
+	 vec3 grow = border;                        // px para fora
+	 vec3 skip = (1.0 - border) * 1e4;          // aresta interna: sempre "longe"
+	 for (int i = 0; i < 3; ++i)
+	 {
+		 vec3 lambda = -grow / h;
+		 lambda[i] = 0.0;
+		 lambda[i] = 1.0 - (lambda.x + lambda.y + lambda.z);
+		 gl_Position = lambda.x * gl_in[0].gl_Position + lambda.y * gl_in[1].gl_Position + lambda.z * gl_in[2].gl_Position;
+		 edgeDistance = lambda * h + skip;
+ #ifdef VERTEX_COLOR
+		 triangleColor = vColor[0];
+ #endif
+		 EmitVertex();
+	 }
+	 EndPrimitive();
+ }
+ )";
+
+    static constexpr const GLchar *fragmentSrc = R"(
+ #version 400
+ #ifdef VERTEX_COLOR
+ flat in vec4 triangleColor;
+ #define inputColor triangleColor
+ #else
+ uniform vec4 inputColor;
+ #endif
+ noperspective in vec3 edgeDistance;
+ out vec4 color;
+ void main()
+ {
+	 float d = min(edgeDistance.x, min(edgeDistance.y, edgeDistance.z));
+	 color = vec4(inputColor.rgb, inputColor.a * clamp(d + 0.5, 0.0, 1.0));
+ }
+ )";
+
+    AAMode current;
+    std::vector<GLuint> programs;
+    GLuint fbo = 0, colorBuffer = 0, depthBuffer = 0;
+    int width = 0, height = 0, fbWidth = 0, fbHeight = 0;
+};
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// Medição repetível para benchmarks de CPU: aquecimento, muitas amostras e
+// mediana/MAD (desvio absoluto mediano), que são pouco sensíveis a picos do
+// sistema. Funções muito curtas são repetidas dentro de cada amostra até
+// passarem de ~20 us, para que a resolução do relógio não domine.
+
+// Impede o compilador de descartar um resultado que ninguém lê
+inline void benchKeep(const void *p)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "g"(p) : "memory");
+#else
+    static const void *volatile sink;
+    sink = p;
+#endif
+}
+
+struct BenchResult
+{
+    std::string name;
+    double medianNs = 0.0; // por chamada
+    double madNs = 0.0;
+    int samples = 0;
+    long long repsPerSample = 0;
+    double items = 0.0; // vértices (ou triângulos) produzidos por chamada
+    double bytes = 0.0; // bytes escritos/copiados por chamada
+
+    double nsPerItem() const { return items > 0.0 ? medianNs / items : 0.0; }
+    double gbPerSecond() const { return medianNs > 0.0 ? bytes / medianNs : 0.0; } // bytes/ns == GB/s
+};
+
+inline double benchMedian(std::vector<double> v)
+{
+    if (v.empty())
+        return 0.0;
+    std::nth_element(v.begin(), v.begin() + v.size() / 2, v.end());
+    return v[v.size() / 2];
+}
+
+template <class F>
+BenchResult benchRun(const std::string &name, F &&fn, double items, double bytes, int warmup = 20,
+                     int samples = 200)
+{
+    using clock = std::chrono::steady_clock;
+
+    for (int i = 0; i < warmup; ++i)
+        fn();
+
+    // Calibra quantas repetições cabem em uma amostra
+    long long reps = 1;
+    for (;;)
+    {
+        auto t0 = clock::now();
+        for (long long r = 0; r < reps; ++r)
+            fn();
+        double ns = std::chrono::duration<double, std::nano>(clock::now() - t0).count();
+        if (ns >= 20000.0 || reps >= (1LL << 24))
+            break;
+        reps *= 2;
+    }
+
+    std::vector<double> perCall;
+    perCall.reserve(samples);
+    for (int s = 0; s < samples; ++s)
+    {
+        auto t0 = clock::now();
+        for (long long r = 0; r < reps; ++r)
+            fn();
+        double ns = std::chrono::duration<double, std::nano>(clock::now() - t0).count();
+        perCall.push_back(ns / reps);
+    }
+
+    BenchResult res;
+    res.name = name;
+    res.medianNs = benchMedian(perCall);
+    for (double &v : perCall)
+        v = std::fabs(v - res.medianNs);
+    res.madNs = benchMedian(perCall);
+    res.samples = samples;
+    res.repsPerSample = reps;
+    res.items = items;
+    res.bytes = bytes;
+    return res;
+}
+
+inline void benchPrint(const BenchResult &r)
+{
+    std::printf("%-34s %12.1f ns  +-%8.1f", r.name.c_str(), r.medianNs, r.madNs);
+    if (r.items > 0.0)
+        std::printf("  %8.3f ns/vert", r.nsPerItem());
+    if (r.bytes > 0.0)
+        std::printf("  %8.2f GB/s", r.gbPerSecond());
+    std::printf("\n");
+}
+
+// Grava os resultados em JSON (um objeto por benchmark) para comparar entre commits
+inline bool benchWriteJson(const std::string &path, const std::vector<BenchResult> &results)
+{
+    FILE *f = std::fopen(path.c_str(), "w");
+    if (!f)
+        return false;
+    std::fprintf(f, "{\n  \"benchmarks\": [\n");
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const BenchResult &r = results[i];
+        std::fprintf(f,
+                     "    {\"name\": \"%s\", \"median_ns\": %.3f, \"mad_ns\": %.3f, \"samples\": %d, "
+                     "\"reps_per_sample\": %lld, \"items\": %.0f, \"bytes\": %.0f, "
+                     "\"ns_per_item\": %.5f, \"gb_per_s\": %.4f}%s\n",
+                     r.name.c_str(), r.medianNs, r.madNs, r.samples, r.repsPerSample, r.items, r.bytes,
+                     r.nsPerItem(), r.gbPerSecond(), i + 1 < results.size() ? "," : "");
+    }
+    std::fprintf(f, "  ]\n}\n");
+    std::fclose(f);
+    return true;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <algorithm>
+
+// Câmera 2D de um canvas: o ponto do mundo no canto superior esquerdo da
+// janela e a escala em pixels por unidade. Com os valores iniciais o mundo
+// coincide com os pixels da janela (y para baixo), como nos exercícios.
+//
+//   camera.pan(dx, dy)             arrasto em pixels
+//   camera.zoomAt(1.1f, px, py)    zoom mantendo fixo o ponto sob o cursor
+//   ortho(camera.left(), camera.right(w), camera.bottom(h), camera.top(), -1, 1)
+class Camera2D
+{
+public:
+    float x = 0.0f, y = 0.0f; // mundo no canto superior esquerdo
+    float zoom = 1.0f;        // pixels por unidade do mundo
+    float minZoom = 1e-4f, maxZoom = 1e3f;
+
+    void reset()
+    {
+        x = y = 0.0f;
+        zoom = 1.0f;
+    }
+
+    void pan(float dxPixels, float dyPixels)
+    {
+        x -= dxPixels / zoom;
+        y -= dyPixels / zoom;
+    }
+
+    void zoomAt(float factor, float px, float py)
+    {
+        float wx, wy;
+        toWorld(px, py, wx, wy);
+        zoom = std::min(std::max(zoom * factor, minZoom), maxZoom);
+        x = wx - px / zoom;
+        y = wy - py / zoom;
+    }
+
+    void toWorld(float px, float py, float &wx, float &wy) const
+    {
+        wx = x + px / zoom;
+        wy = y + py / zoom;
+    }
+
+    float left() const { return x; }
+    float top() const { return y; }
+    float right(int width) const { return x + width / zoom; }
+    float bottom(int height) const { return y + height / zoom; }
+};
@@ -0,0 +1,317 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include <glad/glad.h>
+
+#include "Color.h"
+#include "Path.h"
+#include "ShaderProgram.h"
+
+// Desenho 2D imediato: cada chamada acrescenta triângulos a uma arena da CPU
+// (um vetor que só cresce e é reaproveitado a cada quadro) e o conteúdo vai
+// para a GPU num único VBO de streaming, em um draw por lote. Um lote só é
+// enviado quando o estado muda (transformação, mistura), quando a arena passa
+// de batchVertices ou em endFrame().
+//
+//   Canvas canvas;  canvas.init();
+//   canvas.beginFrame(w, h);
+//   canvas.fillRect(-0.5f, -0.5f, 0.5f, 0.5f, canvasColor(1, 0, 0));
+//   canvas.strokeLine(-1, 0, 1, 0, 0.01f, canvasColor(0, 0, 0));
+//   canvas.endFrame();
+//
+// As coordenadas passam por `transform` (identidade = NDC, como na lista 1);
+// larguras e raios estão nas mesmas unidades.
+//
+// O VBO é escrito por faixas com glMapBufferRange(UNSYNCHRONIZED): enquanto
+// cabe, cada lote vai depois do anterior; quando acaba o espaço o buffer é
+// órfão (glBufferData com NULL) e a escrita volta ao início, sem esperar pela
+// GPU. O mapeamento persistente exigiria GL 4.4, e a lista 1 cria contexto 4.0.
+
+struct CanvasVertex
+{
+    float x, y;
+    uint32_t color;
+};
+
+class Canvas
+{
+public:
+    size_t batchVertices = 1 << 20;    // acima disso o lote é enviado sem esperar mudança de estado
+    size_t bufferBytes = 16u << 20;    // tamanho do VBO de streaming
+
+    bool init()
+    {
+        program = link();
+        if (!program)
+            return false;
+        transformLoc = glGetUniformLocation(program, "transform");
+
+        glGenVertexArrays(1, &vao);
+        glGenBuffers(1, &vbo);
+        glBindVertexArray(vao);
+        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        glBufferData(GL_ARRAY_BUFFER, bufferBytes, NULL, GL_STREAM_DRAW);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(CanvasVertex), (GLvoid *)0);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(CanvasVertex), (GLvoid *)(2 * sizeof(float)));
+        glEnableVertexAttribArray(1);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindVertexArray(0);
+        return true;
+    }
+
+    // Tamanho do framebuffer, para escolher quantos segmentos cada círculo precisa
+    void beginFrame(int w, int h)
+    {
+        viewportW = w;
+        viewportH = h;
+        drawCalls = 0;
+        primitives = 0;
+    }
+
+    void endFrame() { flush(); }
+
+    // Matriz 4x4 por colunas (como glUniformMatrix4fv); muda o estado, então envia o lote atual
+    void setTransform(const float *m)
+    {
+        if (std::memcmp(m, transform, sizeof(transform)) == 0)
+            return;
+        flush();
+        std::memcpy(transform, m, sizeof(transform));
+    }
+
+    // Mistura alfa (GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA) para as próximas primitivas
+    void setBlend(bool enabled)
+    {
+        if (enabled == blend)
+            return;
+        flush();
+        blend = enabled;
+    }
+
+    void fillTriangle(float x0, float y0, float x1, float y1, float x2, float y2, uint32_t color)
+    {
+        CanvasVertex *v = reserve(3);
+        v[0] = {x0, y0, color};
+        v[1] = {x1, y1, color};
+        v[2] = {x2, y2, color};
+        ++primitives;
+    }
+
+    void fillRect(float x0, float y0, float x1, float y1, uint32_t color)
+    {
+        CanvasVertex *v = reserve(6);
+        v[0] = {x0, y0, color};
+        v[1] = {x1, y0, color};
+        v[2] = {x1, y1, color};
+        v[3] = {x0, y0, color};
+        v[4] = {x1, y1, color};
+        v[5] = {x0, y1, color};
+        ++primitives;
+    }
+
+    // segments = 0: erro de no máximo 1/4 de pixel na borda
+    void fillCircle(float cx, float cy, float radius, uint32_t color, int segments = 0)
+    {
+        if (segments <= 0)
+        {
+            float px = radius * std::sqrt(transform[0] * transform[0] + transform[1] * transform[1]) * 0.5f *
+                       std::max(viewportW, viewportH);
+            float step = px > 0.25f ? 2.0f * std::acos(std::max(1.0f - 0.25f / px, -1.0f)) : 2.0f * M_PI;
+            segments = std::min(std::max(static_cast<int>(std::ceil(2.0f * M_PI / step)), 8), 512);
+        }
+        CanvasVertex *v = reserve(segments * 3);
+        float step = 2.0f * M_PI / segments;
+        float px = cx + radius, py = cy;
+        for (int i = 1; i <= segments; ++i)
+        {
+            float x = cx + radius * std::cos(step * i), y = cy + radius * std::sin(step * i);
+            v[0] = {cx, cy, color};
+            v[1] = {px, py, color};
+            v[2] = {x, y, color};
+            v += 3;
+            px = x;
+            py = y;
+        }
+        ++primitives;
+    }
+
+    void strokeLine(float x0, float y0, float x1, float y1, float width, uint32_t color)
+    {
+        float dx = x1 - x0, dy = y1 - y0;
+        float len = std::sqrt(dx * dx + dy * dy);
+        if (len == 0.0f)
+            return;
+        float nx = -dy / len * width * 0.5f, ny = dx / len * width * 0.5f;
+        CanvasVertex *v = reserve(6);
+        v[0] = {x0 + nx, y0 + ny, color};
+        v[1] = {x0 - nx, y0 - ny, color};
+        v[2] = {x1 + nx, y1 + ny, color};
+        v[3] = {x1 + nx, y1 + ny, color};
+        v[4] = {x0 - nx, y0 - ny, color};
+        v[5] = {x1 - nx, y1 - ny, color};
+        ++primitives;
+    }
+
+    // Polígono simples (côncavo ou convexo) com n pontos x, y
+    void fillPolygon(const float *xy, int n, uint32_t color)
+    {
+        polygon.clear();
+        polygon.xy.assign(xy, xy + 2 * n);
+        polygon.starts.push_back(0);
+        polygon.closed.push_back(1);
+        triangles.clear();
+        fillTriangles(polygon, triangles);
+        size_t count = triangles.size() / 3;
+        CanvasVertex *v = reserve(count);
+        for (size_t i = 0; i < count; ++i)
+            v[i] = {triangles[3 * i], triangles[3 * i + 1], color};
+        ++primitives;
+    }
+
+    // Envia o lote atual num draw só
+    void flush()
+    {
+        size_t count = arena.size();
+        if (count == 0)
+            return;
+        size_t bytes = count * sizeof(CanvasVertex);
+
+        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        if (bytes > bufferBytes)
+        {
+            bufferBytes = bytes * 2;
+            glBufferData(GL_ARRAY_BUFFER, bufferBytes, NULL, GL_STREAM_DRAW);
+            offset = 0;
+        }
+        else if (offset + bytes > bufferBytes)
+        {
+            glBufferData(GL_ARRAY_BUFFER, bufferBytes, NULL, GL_STREAM_DRAW); // órfão
+            offset = 0;
+        }
+        void *dst = glMapBufferRange(GL_ARRAY_BUFFER, offset, bytes,
+                                     GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+        bool written = false;
+        if (dst)
+        {
+            std::memcpy(dst, arena.data(), bytes);
+            written = glUnmapBuffer(GL_ARRAY_BUFFER) == GL_TRUE; // GL_FALSE: conteúdo perdido
+        }
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        // Sem os vértices no VBO o draw mostraria o lote de um quadro antigo:
+        // o lote é descartado e o primeiro descarte vai para o stderr
+        if (!written)
+        {
+            if (droppedBatches++ == 0)
+                std::cerr << "Canvas: " << (dst ? "glUnmapBuffer" : "glMapBufferRange") << " falhou, lote de "
+                          << count << " vertices descartado" << std::endl;
+            arena.clear();
+            return;
+        }
+
+        GLint previous;
+        glGetIntegerv(GL_CURRENT_PROGRAM, &previous);
+        glUseProgram(program);
+        glUniformMatrix4fv(transformLoc, 1, GL_FALSE, transform);
+        // O blend de quem chamou volta como estava, ligado ou não
+        GLboolean blendWasEnabled = glIsEnabled(GL_BLEND);
+        GLint savedBlend[4];
+        glGetIntegerv(GL_BLEND_SRC_RGB, &savedBlend[0]);
+        glGetIntegerv(GL_BLEND_DST_RGB, &savedBlend[1]);
+        glGetIntegerv(GL_BLEND_SRC_ALPHA, &savedBlend[2]);
+        glGetIntegerv(GL_BLEND_DST_ALPHA, &savedBlend[3]);
+        if (blend)
+        {
+            glEnable(GL_BLEND);
+            glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        }
+        else
+            glDisable(GL_BLEND);
+        glBindVertexArray(vao);
+        glDrawArrays(GL_TRIANGLES, static_cast<GLint>(offset / sizeof(CanvasVertex)), static_cast<GLsizei>(count));
+        glBindVertexArray(0);
+        glBlendFuncSeparate(savedBlend[0], savedBlend[1], savedBlend[2], savedBlend[3]);
+        if (blendWasEnabled)
+            glEnable(GL_BLEND);
+        else
+            glDisable(GL_BLEND);
+        glUseProgram(previous);
+
+        offset += bytes;
+        arena.clear();
+        ++drawCalls;
+    }
+
+    // Estatísticas do quadro atual
+    int drawCallCount() const { return drawCalls; }
+    size_t primitiveCount() const { return primitives; }
+    size_t droppedBatchCount() const { return droppedBatches; } // lotes perdidos desde init()
+
+    // Lote ainda não enviado; discardPending() o joga fora sem tocar no OpenGL
+    // (o GeometryBench mede só a parte de CPU)
+    const std::vector<CanvasVertex> &pending() const { return arena; }
+    void discardPending() { arena.clear(); }
+
+    void release()
+    {
+        glDeleteProgram(program);
+        glDeleteBuffers(1, &vbo);
+        glDeleteVertexArrays(1, &vao);
+        program = vbo = vao = 0;
+    }
+
+private:
+    CanvasVertex *reserve(size_t n)
+    {
+        if (arena.size() + n > batchVertices && !arena.empty())
+            flush();
+        size_t first = arena.size();
+        arena.resize(first + n);
+        return arena.data() + first;
+    }
+
+    static GLuint link()
+    {
+        static const GLchar *vsText = R"(
+ #version 400
+ layout (location = 0) in vec2 position;
+ layout (location = 1) in vec4 vertexColor;
+ uniform mat4 transform;
+ out vec4 vColor;
+ void main()
+ {
+	 vColor = vertexColor;
+	 gl_Position = transform * vec4(position, 0.0, 1.0);
+ }
+ )";
+        static const GLchar *fsText = R"(
+ #version 400
+ in vec4 vColor;
+ out vec4 color;
+ void main()
+ {
+	 color = vColor;
+ }
+ )";
+        return linkProgram(vsText, fsText, "Canvas");
+    }
+
+    GLuint program = 0, vao = 0, vbo = 0;
+    GLint transformLoc = -1;
+    float transform[16] = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1};
+    bool blend = false;
+    int viewportW = 800, viewportH = 800;
+    std::vector<CanvasVertex> arena;
+    size_t offset = 0;
+    int drawCalls = 0;
+    size_t primitives = 0;
+    size_t droppedBatches = 0;
+    FlatPath polygon;
+    std::vector<GLfloat> triangles;
+};
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// Formato "Trace Event" do Chrome (abre em chrome://tracing e no Perfetto).
+// Cada evento completo ("ph":"X") tem início e duração em microssegundos
+// contados a partir do início do processo.
+
+struct TraceEvent
+{
+    const char *name; // literal de string (não é copiado)
+    const char *category;
+    double startUs;
+    double durationUs;
+    uint32_t thread;
+};
+
+// Origem dos tempos: inicializada antes do main
+inline const std::chrono::steady_clock::time_point traceEpoch = std::chrono::steady_clock::now();
+
+inline double traceNowUs()
+{
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - traceEpoch).count();
+}
+
+inline void traceWriteEscaped(FILE *f, const char *s)
+{
+    for (; *s; ++s)
+    {
+        if (*s == '"' || *s == '\\')
+            std::fputc('\\', f);
+        std::fputc(*s, f);
+    }
+}
+
+inline void traceWriteEvent(FILE *f, const TraceEvent &e, bool first)
+{
+    std::fprintf(f, "%s\n{\"name\":\"", first ? "" : ",");
+    traceWriteEscaped(f, e.name);
+    std::fprintf(f, "\",\"cat\":\"");
+    traceWriteEscaped(f, e.category);
+    std::fprintf(f, "\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}", e.startUs, e.durationUs,
+                 e.thread);
+}
+
+inline bool writeChromeTrace(const std::string &path, const std::vector<TraceEvent> &events)
+{
+    FILE *f = std::fopen(path.c_str(), "w");
+    if (!f)
+        return false;
+    std::fprintf(f, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    for (size_t i = 0; i < events.size(); ++i)
+        traceWriteEvent(f, events[i], i == 0);
+    std::fprintf(f, "\n]}\n");
+    std::fclose(f);
+    return true;
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+// RGBA8 empacotado na ordem de memória r, g, b, a (atributo GL_UNSIGNED_BYTE
+// normalizado), usado pelo Canvas e pelo RectBatch
+inline uint32_t canvasColor(float r, float g, float b, float a = 1.0f)
+{
+    auto c = [](float v) { return static_cast<uint32_t>(std::min(std::max(v, 0.0f), 1.0f) * 255.0f + 0.5f); };
+    return c(r) | (c(g) << 8) | (c(b) << 16) | (c(a) << 24);
+}
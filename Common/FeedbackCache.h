@@ -0,0 +1,129 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#include <glad/glad.h>
+
+#include "ShaderProgram.h"
+
+// Cache de geometria gerada por shader. O gerador é um vertex shader que
+// calcula cada vértice a partir de gl_VertexID e de `uniform float params[8]`
+// e escreve `out vec3 outPosition`. Com transform feedback o resultado é
+// gravado num VBO uma vez por mudança de parâmetros; enquanto eles não mudam
+// os quadros seguintes (e as cópias instanciadas) desenham direto do VBO.
+//
+//   FeedbackCache cache;
+//   cache.init(generatorSrc, 190);
+//   cache.update(params, 3);        // acerto se params == última captura
+//   cache.draw(GL_LINE_STRIP);      // com o programa de desenho já em uso
+//
+// O VBO segue o layout dos exercícios (location 0, vec3), então o shader de
+// desenho de sempre serve.
+class FeedbackCache
+{
+public:
+    static const int maxParams = 8;
+
+    bool init(const GLchar *generatorSrc, GLsizei vertexCount)
+    {
+        vertices = vertexCount;
+
+        GLuint vs = compileShader(GL_VERTEX_SHADER, generatorSrc);
+        // Só o vertex shader, capturado antes do rasterizador
+        program = linkStages(&vs, 1, "FeedbackCache", [](GLuint prog) {
+            const GLchar *varyings[] = {"outPosition"};
+            glTransformFeedbackVaryings(prog, 1, varyings, GL_INTERLEAVED_ATTRIBS);
+        });
+        if (!program)
+            return false;
+        paramsLoc = glGetUniformLocation(program, "params");
+
+        glGenBuffers(1, &vbo);
+        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        glBufferData(GL_ARRAY_BUFFER, vertices * 3 * sizeof(GLfloat), NULL, GL_STATIC_DRAW);
+
+        // O core profile exige um VAO ligado mesmo sem atributos
+        glGenVertexArrays(1, &captureVao);
+
+        glGenVertexArrays(1, &drawVao);
+        glBindVertexArray(drawVao);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(GLfloat), (GLvoid *)0);
+        glEnableVertexAttribArray(0);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindVertexArray(0);
+        return true;
+    }
+
+    // Garante que o VBO tem a geometria destes parâmetros. Devolve true se já
+    // tinha (acerto) e false se precisou capturar de novo (falha). Deixa o
+    // programa atual como estava.
+    bool update(const float *params, int count)
+    {
+        if (count > maxParams)
+            count = maxParams;
+        if (count == keyCount && std::memcmp(params, key, count * sizeof(float)) == 0)
+        {
+            ++hitCount;
+            return true;
+        }
+        ++missCount;
+        std::memcpy(key, params, count * sizeof(float));
+        keyCount = count;
+
+        GLint previous;
+        glGetIntegerv(GL_CURRENT_PROGRAM, &previous);
+        glUseProgram(program);
+        glUniform1fv(paramsLoc, count, params);
+        glEnable(GL_RASTERIZER_DISCARD);
+        glBindVertexArray(captureVao);
+        glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, vbo);
+        glBeginTransformFeedback(GL_POINTS);
+        glDrawArrays(GL_POINTS, 0, vertices);
+        glEndTransformFeedback();
+        glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, 0);
+        glDisable(GL_RASTERIZER_DISCARD);
+        glBindVertexArray(0);
+        glUseProgram(previous);
+        return false;
+    }
+
+    void draw(GLenum mode) const
+    {
+        glBindVertexArray(drawVao);
+        glDrawArrays(mode, 0, vertices);
+        glBindVertexArray(0);
+    }
+
+    // Várias cópias da mesma captura; o shader de desenho usa gl_InstanceID
+    void drawInstanced(GLenum mode, GLsizei instances) const
+    {
+        glBindVertexArray(drawVao);
+        glDrawArraysInstanced(mode, 0, vertices, instances);
+        glBindVertexArray(0);
+    }
+
+    GLuint buffer() const { return vbo; }
+    uint64_t hits() const { return hitCount; }
+    uint64_t misses() const { return missCount; }
+
+    // Força nova captura no próximo update (ex.: o gerador depende de algo fora de params)
+    void invalidate() { keyCount = -1; }
+
+    void release()
+    {
+        glDeleteProgram(program);
+        glDeleteBuffers(1, &vbo);
+        glDeleteVertexArrays(1, &captureVao);
+        glDeleteVertexArrays(1, &drawVao);
+        program = vbo = captureVao = drawVao = 0;
+    }
+
+private:
+    GLuint program = 0, vbo = 0, captureVao = 0, drawVao = 0;
+    GLint paramsLoc = -1;
+    GLsizei vertices = 0;
+    float key[maxParams];
+    int keyCount = -1;
+    uint64_t hitCount = 0, missCount = 0;
+};
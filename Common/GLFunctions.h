@@ -0,0 +1,100 @@
+// Gerado por tools/gen_gl_functions.py -- não editar à mão.
+// Funções OpenGL referenciadas pelo projeto (97 de 782 da GLAD).
+
+GL_FUNCTION(PFNGLACTIVETEXTUREPROC, glActiveTexture)
+GL_FUNCTION(PFNGLATTACHSHADERPROC, glAttachShader)
+GL_FUNCTION(PFNGLBEGINTRANSFORMFEEDBACKPROC, glBeginTransformFeedback)
+GL_FUNCTION(PFNGLBINDBUFFERPROC, glBindBuffer)
+GL_FUNCTION(PFNGLBINDBUFFERBASEPROC, glBindBufferBase)
+GL_FUNCTION(PFNGLBINDFRAMEBUFFERPROC, glBindFramebuffer)
+GL_FUNCTION(PFNGLBINDRENDERBUFFERPROC, glBindRenderbuffer)
+GL_FUNCTION(PFNGLBINDTEXTUREPROC, glBindTexture)
+GL_FUNCTION(PFNGLBINDVERTEXARRAYPROC, glBindVertexArray)
+GL_FUNCTION(PFNGLBLENDFUNCPROC, glBlendFunc)
+GL_FUNCTION(PFNGLBLENDFUNCSEPARATEPROC, glBlendFuncSeparate)
+GL_FUNCTION(PFNGLBLENDFUNCIPROC, glBlendFunci)
+GL_FUNCTION(PFNGLBLITFRAMEBUFFERPROC, glBlitFramebuffer)
+GL_FUNCTION(PFNGLBUFFERDATAPROC, glBufferData)
+GL_FUNCTION(PFNGLBUFFERSUBDATAPROC, glBufferSubData)
+GL_FUNCTION(PFNGLCHECKFRAMEBUFFERSTATUSPROC, glCheckFramebufferStatus)
+GL_FUNCTION(PFNGLCLEARPROC, glClear)
+GL_FUNCTION(PFNGLCLEARBUFFERFVPROC, glClearBufferfv)
+GL_FUNCTION(PFNGLCLEARCOLORPROC, glClearColor)
+GL_FUNCTION(PFNGLCLIENTWAITSYNCPROC, glClientWaitSync)
+GL_FUNCTION(PFNGLCOMPILESHADERPROC, glCompileShader)
+GL_FUNCTION(PFNGLCREATEPROGRAMPROC, glCreateProgram)
+GL_FUNCTION(PFNGLCREATESHADERPROC, glCreateShader)
+GL_FUNCTION(PFNGLDELETEBUFFERSPROC, glDeleteBuffers)
+GL_FUNCTION(PFNGLDELETEFRAMEBUFFERSPROC, glDeleteFramebuffers)
+GL_FUNCTION(PFNGLDELETEPROGRAMPROC, glDeleteProgram)
+GL_FUNCTION(PFNGLDELETEQUERIESPROC, glDeleteQueries)
+GL_FUNCTION(PFNGLDELETERENDERBUFFERSPROC, glDeleteRenderbuffers)
+GL_FUNCTION(PFNGLDELETESHADERPROC, glDeleteShader)
+GL_FUNCTION(PFNGLDELETESYNCPROC, glDeleteSync)
+GL_FUNCTION(PFNGLDELETETEXTURESPROC, glDeleteTextures)
+GL_FUNCTION(PFNGLDELETEVERTEXARRAYSPROC, glDeleteVertexArrays)
+GL_FUNCTION(PFNGLDEPTHFUNCPROC, glDepthFunc)
+GL_FUNCTION(PFNGLDISABLEPROC, glDisable)
+GL_FUNCTION(PFNGLDRAWARRAYSPROC, glDrawArrays)
+GL_FUNCTION(PFNGLDRAWARRAYSINSTANCEDPROC, glDrawArraysInstanced)
+GL_FUNCTION(PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC, glDrawArraysInstancedBaseInstance)
+GL_FUNCTION(PFNGLDRAWBUFFERSPROC, glDrawBuffers)
+GL_FUNCTION(PFNGLENABLEPROC, glEnable)
+GL_FUNCTION(PFNGLENABLEVERTEXATTRIBARRAYPROC, glEnableVertexAttribArray)
+GL_FUNCTION(PFNGLENDTRANSFORMFEEDBACKPROC, glEndTransformFeedback)
+GL_FUNCTION(PFNGLFENCESYNCPROC, glFenceSync)
+GL_FUNCTION(PFNGLFINISHPROC, glFinish)
+GL_FUNCTION(PFNGLFRAMEBUFFERRENDERBUFFERPROC, glFramebufferRenderbuffer)
+GL_FUNCTION(PFNGLFRAMEBUFFERTEXTURE2DPROC, glFramebufferTexture2D)
+GL_FUNCTION(PFNGLFRAMEBUFFERTEXTURELAYERPROC, glFramebufferTextureLayer)
+GL_FUNCTION(PFNGLGENBUFFERSPROC, glGenBuffers)
+GL_FUNCTION(PFNGLGENFRAMEBUFFERSPROC, glGenFramebuffers)
+GL_FUNCTION(PFNGLGENQUERIESPROC, glGenQueries)
+GL_FUNCTION(PFNGLGENRENDERBUFFERSPROC, glGenRenderbuffers)
+GL_FUNCTION(PFNGLGENTEXTURESPROC, glGenTextures)
+GL_FUNCTION(PFNGLGENVERTEXARRAYSPROC, glGenVertexArrays)
+GL_FUNCTION(PFNGLGENERATEMIPMAPPROC, glGenerateMipmap)
+GL_FUNCTION(PFNGLGETINTEGERVPROC, glGetIntegerv)
+GL_FUNCTION(PFNGLGETPROGRAMINFOLOGPROC, glGetProgramInfoLog)
+GL_FUNCTION(PFNGLGETPROGRAMIVPROC, glGetProgramiv)
+GL_FUNCTION(PFNGLGETQUERYOBJECTIVPROC, glGetQueryObjectiv)
+GL_FUNCTION(PFNGLGETQUERYOBJECTUI64VPROC, glGetQueryObjectui64v)
+GL_FUNCTION(PFNGLGETSHADERINFOLOGPROC, glGetShaderInfoLog)
+GL_FUNCTION(PFNGLGETSHADERIVPROC, glGetShaderiv)
+GL_FUNCTION(PFNGLGETSTRINGPROC, glGetString)
+GL_FUNCTION(PFNGLGETSTRINGIPROC, glGetStringi)
+GL_FUNCTION(PFNGLGETUNIFORMLOCATIONPROC, glGetUniformLocation)
+GL_FUNCTION(PFNGLISENABLEDPROC, glIsEnabled)
+GL_FUNCTION(PFNGLLINEWIDTHPROC, glLineWidth)
+GL_FUNCTION(PFNGLLINKPROGRAMPROC, glLinkProgram)
+GL_FUNCTION(PFNGLMAPBUFFERRANGEPROC, glMapBufferRange)
+GL_FUNCTION(PFNGLMULTIDRAWARRAYSPROC, glMultiDrawArrays)
+GL_FUNCTION(PFNGLPATCHPARAMETERIPROC, glPatchParameteri)
+GL_FUNCTION(PFNGLPIXELSTOREIPROC, glPixelStorei)
+GL_FUNCTION(PFNGLPOINTSIZEPROC, glPointSize)
+GL_FUNCTION(PFNGLQUERYCOUNTERPROC, glQueryCounter)
+GL_FUNCTION(PFNGLREADBUFFERPROC, glReadBuffer)
+GL_FUNCTION(PFNGLREADPIXELSPROC, glReadPixels)
+GL_FUNCTION(PFNGLRENDERBUFFERSTORAGEPROC, glRenderbufferStorage)
+GL_FUNCTION(PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC, glRenderbufferStorageMultisample)
+GL_FUNCTION(PFNGLSHADERSOURCEPROC, glShaderSource)
+GL_FUNCTION(PFNGLTEXBUFFERPROC, glTexBuffer)
+GL_FUNCTION(PFNGLTEXIMAGE2DPROC, glTexImage2D)
+GL_FUNCTION(PFNGLTEXIMAGE3DPROC, glTexImage3D)
+GL_FUNCTION(PFNGLTEXPARAMETERIPROC, glTexParameteri)
+GL_FUNCTION(PFNGLTEXSUBIMAGE3DPROC, glTexSubImage3D)
+GL_FUNCTION(PFNGLTRANSFORMFEEDBACKVARYINGSPROC, glTransformFeedbackVaryings)
+GL_FUNCTION(PFNGLUNIFORM1FPROC, glUniform1f)
+GL_FUNCTION(PFNGLUNIFORM1FVPROC, glUniform1fv)
+GL_FUNCTION(PFNGLUNIFORM1IPROC, glUniform1i)
+GL_FUNCTION(PFNGLUNIFORM1IVPROC, glUniform1iv)
+GL_FUNCTION(PFNGLUNIFORM2FPROC, glUniform2f)
+GL_FUNCTION(PFNGLUNIFORM2IPROC, glUniform2i)
+GL_FUNCTION(PFNGLUNIFORM4FPROC, glUniform4f)
+GL_FUNCTION(PFNGLUNIFORM4FVPROC, glUniform4fv)
+GL_FUNCTION(PFNGLUNIFORMMATRIX4FVPROC, glUniformMatrix4fv)
+GL_FUNCTION(PFNGLUNMAPBUFFERPROC, glUnmapBuffer)
+GL_FUNCTION(PFNGLUSEPROGRAMPROC, glUseProgram)
+GL_FUNCTION(PFNGLVERTEXATTRIBDIVISORPROC, glVertexAttribDivisor)
+GL_FUNCTION(PFNGLVERTEXATTRIBPOINTERPROC, glVertexAttribPointer)
+GL_FUNCTION(PFNGLVIEWPORTPROC, glViewport)
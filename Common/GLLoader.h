@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <glad/glad.h>
+
+// Carregador OpenGL mínimo.
+//
+// A gladLoadGLLoader resolve as ~780 funções da GLAD (GL 1.0 a 4.6, mais as de
+// ES) pela glfwGetProcAddress, embora cada exercício use umas vinte. Aqui só
+// são resolvidas as funções listadas em GLFunctions.h, que é gerado por
+// tools/gen_gl_functions.py a partir das chamadas gl*() encontradas nos fontes.
+// Os ponteiros preenchidos são os mesmos da GLAD (glad_glXxx), então o resto do
+// código não muda. Uma função nova que não esteja na lista fica nula: rodar o
+// gerador de novo depois de usar uma função que o projeto ainda não chamava.
+//
+// FCG_GL_LOADER=full volta para a gladLoadGLLoader completa (útil para comparar
+// o tempo de inicialização, ver src/Benchmarks/StartupBench.cpp).
+
+// Preenche GLVersion e as flags GLAD_GL_VERSION_X_Y como a GLAD faria
+inline bool glLoaderParseVersion(const char *version)
+{
+    int major = 0, minor = 0;
+    if (!version || std::sscanf(version, "%d.%d", &major, &minor) != 2)
+        return false;
+
+    GLVersion.major = major;
+    GLVersion.minor = minor;
+    int v = major * 10 + minor;
+    GLAD_GL_VERSION_1_0 = v >= 10;
+    GLAD_GL_VERSION_1_1 = v >= 11;
+    GLAD_GL_VERSION_1_2 = v >= 12;
+    GLAD_GL_VERSION_1_3 = v >= 13;
+    GLAD_GL_VERSION_1_4 = v >= 14;
+    GLAD_GL_VERSION_1_5 = v >= 15;
+    GLAD_GL_VERSION_2_0 = v >= 20;
+    GLAD_GL_VERSION_2_1 = v >= 21;
+    GLAD_GL_VERSION_3_0 = v >= 30;
+    GLAD_GL_VERSION_3_1 = v >= 31;
+    GLAD_GL_VERSION_3_2 = v >= 32;
+    GLAD_GL_VERSION_3_3 = v >= 33;
+    GLAD_GL_VERSION_4_0 = v >= 40;
+    GLAD_GL_VERSION_4_1 = v >= 41;
+    GLAD_GL_VERSION_4_2 = v >= 42;
+    GLAD_GL_VERSION_4_3 = v >= 43;
+    GLAD_GL_VERSION_4_4 = v >= 44;
+    GLAD_GL_VERSION_4_5 = v >= 45;
+    GLAD_GL_VERSION_4_6 = v >= 46;
+    return true;
+}
+
+inline int loadGLMinimal(GLADloadproc load)
+{
+    GLVersion.major = 0;
+    GLVersion.minor = 0;
+    glad_glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
+    if (!glad_glGetString)
+        return 0;
+    if (!glLoaderParseVersion(reinterpret_cast<const char *>(glad_glGetString(GL_VERSION))))
+        return 0;
+
+#define GL_FUNCTION(type, name) glad_##name = (type)load(#name);
+#include "GLFunctions.h"
+#undef GL_FUNCTION
+
+    return 1;
+}
+
+// Ponto de entrada usado pelos programas no lugar da gladLoadGLLoader
+inline int loadGL(GLADloadproc load)
+{
+    const char *mode = std::getenv("FCG_GL_LOADER");
+    if (mode && std::strcmp(mode, "full") == 0)
+        return gladLoadGLLoader(load);
+    return loadGLMinimal(load);
+}
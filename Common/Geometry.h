@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cmath>
+#include <vector>
+
+#include <glad/glad.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// Geradores de geometria usados pelos exercícios da lista 1. Só escrevem em
+// arrays na CPU (nenhuma chamada gl*), então também servem para o benchmark.
+// Os ângulos são calculados em double e convertidos para float exatamente
+// como nos laços originais, para que a saída seja idêntica bit a bit.
+
+// Leque de `count` triângulos (centro, borda i, borda i+1) com passo de
+// 2*PI/segments a partir de startAngle. 9 floats por triângulo.
+// count == segments fecha o círculo; count < segments desenha um setor.
+inline void circleFan(GLfloat *out, int count, int segments, float centerX, float centerY,
+                      float radius, double startAngle = 0.0)
+{
+    for (int i = 0; i < count; ++i)
+    {
+        float theta1 = startAngle + 2.0f * M_PI * i / segments;
+        float theta2 = startAngle + 2.0f * M_PI * (i + 1) / segments;
+
+        // Centro do triângulo
+        out[i * 9] = centerX;
+        out[i * 9 + 1] = centerY;
+        out[i * 9 + 2] = 0.0f;
+
+        out[i * 9 + 3] = centerX + radius * std::cos(theta1);
+        out[i * 9 + 4] = centerY + radius * std::sin(theta1);
+        out[i * 9 + 5] = 0.0f;
+
+        out[i * 9 + 6] = centerX + radius * std::cos(theta2);
+        out[i * 9 + 7] = centerY + radius * std::sin(theta2);
+        out[i * 9 + 8] = 0.0f;
+    }
+}
+
+// Estrela: dois triângulos por segmento alternando o raio externo e o interno.
+// 18 floats por segmento.
+inline void starFan(GLfloat *out, int segments, float centerX, float centerY, float radius,
+                    float innerRadius, double startAngle)
+{
+    for (int i = 0; i < segments; ++i)
+    {
+        float theta1 = startAngle + 2.0f * M_PI * i / segments;
+        float theta2 = startAngle + 2.0f * M_PI * (i + 1) / segments;
+
+        out[i * 18] = centerX;
+        out[i * 18 + 1] = centerY;
+        out[i * 18 + 2] = 0.0f;
+
+        out[i * 18 + 3] = centerX + innerRadius * std::cos(theta1);
+        out[i * 18 + 4] = centerY + innerRadius * std::sin(theta1);
+        out[i * 18 + 5] = 0.0f;
+
+        out[i * 18 + 6] = centerX + radius * std::cos(theta2);
+        out[i * 18 + 7] = centerY + radius * std::sin(theta2);
+        out[i * 18 + 8] = 0.0f;
+
+        out[i * 18 + 9] = centerX;
+        out[i * 18 + 10] = centerY;
+        out[i * 18 + 11] = 0.0f;
+
+        out[i * 18 + 12] = centerX + radius * std::cos(theta1);
+        out[i * 18 + 13] = centerY + radius * std::sin(theta1);
+        out[i * 18 + 14] = 0.0f;
+
+        out[i * 18 + 15] = centerX + innerRadius * std::cos(theta2);
+        out[i * 18 + 16] = centerY + innerRadius * std::sin(theta2);
+        out[i * 18 + 17] = 0.0f;
+    }
+}
+
+// Espiral de Arquimedes r = a + b*theta, com theta avançando `step` por ponto.
+// 3 floats por ponto (para GL_LINE_STRIP).
+inline void spiral(GLfloat *out, int points, float centerX, float centerY, float a, float b,
+                   float step)
+{
+    for (int i = 0; i < points; ++i)
+    {
+        float theta = i * step;
+        float radius = a + b * theta;
+
+        out[i * 3] = centerX + radius * std::cos(theta);
+        out[i * 3 + 1] = centerY + radius * std::sin(theta);
+        out[i * 3 + 2] = 0.0f;
+    }
+}
@@ -0,0 +1,185 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdio>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <glad/glad.h>
+
+// Tempo de GPU por passe de render, sem travar o pipeline.
+//
+// Cada begin()/end() grava dois carimbos GL_TIMESTAMP (glQueryCounter), que,
+// ao contrário de GL_TIME_ELAPSED, podem ser aninhados e não têm limite de um
+// ativo por vez. As queries de um quadro só são lidas `latency` quadros depois,
+// quando a GPU com certeza já terminou; se ainda não estiverem prontas o quadro
+// é descartado (contado em lost()) em vez de esperar.
+//
+// Uso, uma vez por quadro:
+//   gpu.beginFrame();
+//   gpu.begin("limpa");  glClear(...);       gpu.end();
+//   gpu.begin("casa");   glDrawArrays(...);  gpu.end();
+//   gpu.endFrame();
+// Passes com o mesmo nome no mesmo quadro são somados.
+class GpuTimer
+{
+public:
+    explicit GpuTimer(int latency = 3) : frames(std::max(2, latency)) {}
+
+    void beginFrame()
+    {
+        Frame &f = frames[current];
+        if (f.used > 0)
+            collect(f, false);
+        f.used = 0;
+        f.names.clear();
+        f.starts.clear();
+        f.ends.clear();
+        begin("quadro");
+    }
+
+    void begin(const char *name)
+    {
+        Frame &f = frames[current];
+        f.names.push_back(name);
+        f.starts.push_back(f.used);
+        f.ends.push_back(-1);
+        f.open.push_back(static_cast<int>(f.names.size()) - 1);
+        glQueryCounter(query(f, f.used++), GL_TIMESTAMP);
+    }
+
+    void end()
+    {
+        Frame &f = frames[current];
+        if (f.open.empty())
+            return;
+        f.ends[f.open.back()] = f.used;
+        f.open.pop_back();
+        glQueryCounter(query(f, f.used++), GL_TIMESTAMP);
+    }
+
+    void endFrame()
+    {
+        end(); // "quadro"
+        current = (current + 1) % frames.size();
+    }
+
+    // Lê tudo o que falta (bloqueia); chamar só no fim, com o contexto ativo
+    void finish()
+    {
+        for (Frame &f : frames)
+            if (f.used > 0)
+                collect(f, true);
+    }
+
+    struct PassStats
+    {
+        std::vector<double> ms; // uma amostra por quadro lido
+
+        double mean() const
+        {
+            double s = 0.0;
+            for (double v : ms)
+                s += v;
+            return ms.empty() ? 0.0 : s / ms.size();
+        }
+        double median() const
+        {
+            if (ms.empty())
+                return 0.0;
+            std::vector<double> v = ms;
+            std::nth_element(v.begin(), v.begin() + v.size() / 2, v.end());
+            return v[v.size() / 2];
+        }
+        double last() const { return ms.empty() ? 0.0 : ms.back(); }
+    };
+
+    const std::map<std::string, PassStats> &passes() const { return stats; }
+    int lost() const { return lostFrames; }
+
+    // Acrescenta uma linha por passe ao CSV (mesmo esquema do regressao.csv)
+    void appendCsv(const std::string &path, const std::string &program) const
+    {
+        bool header = true;
+        if (FILE *probe = std::fopen(path.c_str(), "r"))
+        {
+            header = false;
+            std::fclose(probe);
+        }
+        FILE *out = std::fopen(path.c_str(), "a");
+        if (!out)
+            return;
+        if (header)
+            std::fprintf(out, "programa,passe,amostras,media_gpu_ms,mediana_gpu_ms,quadros_perdidos\n");
+        for (const auto &p : stats)
+            std::fprintf(out, "%s,%s,%zu,%.4f,%.4f,%d\n", program.c_str(), p.first.c_str(), p.second.ms.size(),
+                         p.second.mean(), p.second.median(), lostFrames);
+        std::fclose(out);
+    }
+
+    void release()
+    {
+        for (Frame &f : frames)
+        {
+            if (!f.queries.empty())
+                glDeleteQueries(static_cast<GLsizei>(f.queries.size()), f.queries.data());
+            f = Frame();
+        }
+    }
+
+private:
+    struct Frame
+    {
+        std::vector<GLuint> queries; // pool: cresce e é reaproveitado
+        std::vector<const char *> names;
+        std::vector<int> starts, ends; // índices das queries de cada passe
+        std::vector<int> open;
+        int used = 0;
+    };
+
+    GLuint query(Frame &f, int index)
+    {
+        while (static_cast<int>(f.queries.size()) <= index)
+        {
+            GLuint q;
+            glGenQueries(1, &q);
+            f.queries.push_back(q);
+        }
+        return f.queries[index];
+    }
+
+    void collect(Frame &f, bool wait)
+    {
+        f.open.clear();
+        GLuint lastQuery = f.queries[f.used - 1];
+        if (!wait)
+        {
+            GLint available = 0;
+            glGetQueryObjectiv(lastQuery, GL_QUERY_RESULT_AVAILABLE, &available);
+            if (!available)
+            {
+                ++lostFrames;
+                f.used = 0;
+                return;
+            }
+        }
+
+        std::vector<GLuint64> stamps(f.used);
+        for (int i = 0; i < f.used; ++i)
+            glGetQueryObjectui64v(f.queries[i], GL_QUERY_RESULT, &stamps[i]);
+
+        std::map<std::string, double> frameMs;
+        for (size_t p = 0; p < f.names.size(); ++p)
+            if (f.ends[p] >= 0)
+                frameMs[f.names[p]] += (stamps[f.ends[p]] - stamps[f.starts[p]]) / 1.0e6;
+        for (const auto &m : frameMs)
+            stats[m.first].ms.push_back(m.second);
+        f.used = 0;
+    }
+
+    std::vector<Frame> frames;
+    size_t current = 0;
+    std::map<std::string, PassStats> stats;
+    int lostFrames = 0;
+};
@@ -0,0 +1,566 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define FCG_PATH_SSE2 1
+#endif
+
+#include <glad/glad.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// Caminhos vetoriais (retas, Béziers quadráticas e cúbicas, arcos) achatados em
+// polilinhas com erro máximo em pixels, e os dois consumidores dessas
+// polilinhas: preenchimento (triângulos) e contorno com espessura. Como em
+// Geometry.h, nada aqui chama o OpenGL: a saída são floats x, y, z prontos para
+// a glBufferData, no mesmo layout (location 0, vec3) dos exercícios.
+//
+//   Path p;
+//   p.moveTo(0, 0); p.cubicTo(0.2f, 0.5f, 0.6f, 0.5f, 0.8f, 0); p.close();
+//   FlatPath flat;
+//   flattenPath(p, 0.25f, 400.0f, flat);   // 1/4 de pixel, 400 px por unidade
+//   fillTriangles(flat, fill);             // GL_TRIANGLES
+//   strokeTriangles(flat, 0.01f, stroke);  // GL_TRIANGLES
+
+class Path
+{
+public:
+    enum Verb : uint8_t
+    {
+        Move,
+        Line,
+        Quad,
+        Cubic,
+        Close
+    };
+
+    void moveTo(float x, float y)
+    {
+        verbs.push_back(Move);
+        push(x, y);
+    }
+
+    void lineTo(float x, float y)
+    {
+        ensureStart(x, y);
+        verbs.push_back(Line);
+        push(x, y);
+    }
+
+    void quadTo(float cx, float cy, float x, float y)
+    {
+        ensureStart(cx, cy);
+        verbs.push_back(Quad);
+        push(cx, cy);
+        push(x, y);
+    }
+
+    void cubicTo(float c1x, float c1y, float c2x, float c2y, float x, float y)
+    {
+        ensureStart(c1x, c1y);
+        verbs.push_back(Cubic);
+        push(c1x, c1y);
+        push(c2x, c2y);
+        push(x, y);
+    }
+
+    // Arco de circunferência de startAngle a endAngle (radianos; sentido
+    // anti-horário se endAngle > startAngle). Liga-se ao ponto atual por uma
+    // reta, como o arc() do canvas HTML, e vira uma cúbica a cada 90 graus.
+    void arc(float cx, float cy, float radius, float startAngle, float endAngle)
+    {
+        float x0 = cx + radius * std::cos(startAngle);
+        float y0 = cy + radius * std::sin(startAngle);
+        if (open)
+            lineTo(x0, y0);
+        else
+            moveTo(x0, y0);
+
+        float sweep = endAngle - startAngle;
+        int pieces = std::max(1, static_cast<int>(std::ceil(std::fabs(sweep) / (M_PI / 2.0) - 1e-4)));
+        float step = sweep / pieces;
+        float k = 4.0f / 3.0f * std::tan(step / 4.0f) * radius;
+        for (int i = 0; i < pieces; ++i)
+        {
+            float a0 = startAngle + step * i, a1 = a0 + step;
+            float c0 = std::cos(a0), s0 = std::sin(a0), c1 = std::cos(a1), s1 = std::sin(a1);
+            cubicTo(cx + radius * c0 - k * s0, cy + radius * s0 + k * c0,
+                    cx + radius * c1 + k * s1, cy + radius * s1 - k * c1,
+                    cx + radius * c1, cy + radius * s1);
+        }
+    }
+
+    // Canto arredondado, como o arcTo() do canvas HTML: arco de raio `radius`
+    // tangente às retas (ponto atual, (x1, y1)) e ((x1, y1), (x2, y2)). O
+    // caminho segue em reta até o primeiro ponto de tangência e termina no
+    // segundo. Sem ponto atual, começa em (x1, y1); com pontos repetidos,
+    // colineares ou raio 0, vira uma reta até (x1, y1).
+    void arcTo(float x1, float y1, float x2, float y2, float radius)
+    {
+        if (!open)
+        {
+            moveTo(x1, y1);
+            return;
+        }
+        float x0 = points[points.size() - 2], y0 = points[points.size() - 1];
+        float ux = x0 - x1, uy = y0 - y1, vx = x2 - x1, vy = y2 - y1;
+        float lu = std::hypot(ux, uy), lv = std::hypot(vx, vy);
+        float cross = ux * vy - uy * vx;
+        if (!(radius > 0.0f) || lu < 1e-6f || lv < 1e-6f || std::fabs(cross) < 1e-6f * lu * lv)
+        {
+            lineTo(x1, y1);
+            return;
+        }
+        ux /= lu;
+        uy /= lu;
+        vx /= lv;
+        vy /= lv;
+        // theta: ângulo entre as duas retas no canto; os pontos de tangência
+        // ficam a radius / tan(theta / 2) do canto
+        float theta = std::acos(std::min(std::max(ux * vx + uy * vy, -1.0f), 1.0f));
+        float d = radius / std::tan(0.5f * theta);
+        float bx = ux + vx, by = uy + vy, lb = std::hypot(bx, by);
+        float h = radius / std::sin(0.5f * theta);
+        float cx = x1 + bx / lb * h, cy = y1 + by / lb * h;
+        float start = std::atan2(y1 + uy * d - cy, x1 + ux * d - cx);
+        // cross < 0: o caminho vira à esquerda no canto e o arco é anti-horário
+        float sweep = static_cast<float>(M_PI) - theta;
+        arc(cx, cy, radius, start, cross < 0.0f ? start + sweep : start - sweep);
+    }
+
+    void close()
+    {
+        if (open)
+            verbs.push_back(Close);
+        open = false;
+    }
+
+    void clear()
+    {
+        verbs.clear();
+        points.clear();
+        open = false;
+    }
+
+    bool empty() const { return verbs.empty(); }
+
+    std::vector<uint8_t> verbs;
+    std::vector<float> points; // x, y; Move/Line 1 ponto, Quad 2, Cubic 3
+
+private:
+    void push(float x, float y)
+    {
+        points.push_back(x);
+        points.push_back(y);
+        open = true;
+    }
+
+    // Segmento sem moveTo antes: começa no próprio ponto, como no canvas
+    void ensureStart(float x, float y)
+    {
+        if (!open)
+            moveTo(x, y);
+    }
+
+    bool open = false;
+};
+
+// Polilinhas resultantes: contorno i usa os pontos [start(i), end(i))
+struct FlatPath
+{
+    std::vector<float> xy;
+    std::vector<uint32_t> starts;
+    std::vector<uint8_t> closed;
+
+    size_t contourCount() const { return starts.size(); }
+    uint32_t start(size_t i) const { return starts[i]; }
+    uint32_t end(size_t i) const { return i + 1 < starts.size() ? starts[i + 1] : static_cast<uint32_t>(xy.size() / 2); }
+    size_t pointCount() const { return xy.size() / 2; }
+
+    void clear()
+    {
+        xy.clear();
+        starts.clear();
+        closed.clear();
+    }
+};
+
+// Curvas de um caminho em base de potências, estrutura de arrays:
+// p(t) = ((a*t + b)*t + c)*t + d, avaliadas em t = i/n, i = 1..n.
+struct CurveBatch
+{
+    std::vector<float> ax, bx, cx, dx, ay, by, cy, dy, endX, endY;
+    std::vector<float> bound;    // max |segunda diferença| dos pontos de controle
+    std::vector<float> degree;   // 2 ou 3 (fator de Wang)
+    std::vector<uint32_t> count; // segmentos
+    std::vector<uint32_t> offset; // primeiro ponto de saída em FlatPath::xy
+
+    void clear()
+    {
+        for (std::vector<float> *v : {&ax, &bx, &cx, &dx, &ay, &by, &cy, &dy, &endX, &endY, &bound, &degree})
+            v->clear();
+        count.clear();
+        offset.clear();
+    }
+
+    void addCubic(float x0, float y0, float x1, float y1, float x2, float y2, float x3, float y3, float deg)
+    {
+        ax.push_back(-x0 + 3.0f * x1 - 3.0f * x2 + x3);
+        bx.push_back(3.0f * x0 - 6.0f * x1 + 3.0f * x2);
+        cx.push_back(-3.0f * x0 + 3.0f * x1);
+        dx.push_back(x0);
+        ay.push_back(-y0 + 3.0f * y1 - 3.0f * y2 + y3);
+        by.push_back(3.0f * y0 - 6.0f * y1 + 3.0f * y2);
+        cy.push_back(-3.0f * y0 + 3.0f * y1);
+        dy.push_back(y0);
+        endX.push_back(x3);
+        endY.push_back(y3);
+        degree.push_back(deg);
+    }
+};
+
+// Número de segmentos pelo limite de Wang: para uma Bézier de grau d, n
+// segmentos uniformes ficam a no máximo d(d-1)/8 * M / n^2 da curva, onde M é a
+// maior segunda diferença dos pontos de controle. Sem ramos, vetoriza sozinho.
+// Tolerância <= 0 (ou NaN) vale como PATH_MIN_TOLERANCE, e a contagem fica
+// sempre entre 1 e maxSegments: NaN ou infinito convertido para uint32_t é UB.
+const float PATH_MIN_TOLERANCE = 1e-6f;
+
+inline void pathSegmentCounts(CurveBatch &batch, float tolerance, uint32_t maxSegments = 4096)
+{
+    size_t n = batch.bound.size();
+    batch.count.resize(n);
+    float inv = 1.0f / (tolerance > PATH_MIN_TOLERANCE ? tolerance : PATH_MIN_TOLERANCE);
+    float limit = static_cast<float>(std::min(std::max(maxSegments, 1u), 1u << 24)); // exato em float
+    for (size_t i = 0; i < n; ++i)
+    {
+        float d = batch.degree[i];
+        float segments = std::ceil(std::sqrt(d * (d - 1.0f) * 0.125f * batch.bound[i] * inv));
+        segments = segments >= 1.0f ? std::min(segments, limit) : 1.0f;
+        batch.count[i] = static_cast<uint32_t>(segments);
+    }
+}
+
+// Avalia todas as curvas do lote direto na saída, 4 valores de t por vez
+inline void pathEvaluate(const CurveBatch &batch, float *xy)
+{
+    for (size_t c = 0; c < batch.count.size(); ++c)
+    {
+        uint32_t n = batch.count[c];
+        float *out = xy + 2 * static_cast<size_t>(batch.offset[c]);
+        float ax = batch.ax[c], bx = batch.bx[c], cx = batch.cx[c], dx = batch.dx[c];
+        float ay = batch.ay[c], by = batch.by[c], cy = batch.cy[c], dy = batch.dy[c];
+        float dt = 1.0f / n;
+        uint32_t i = 0;
+#ifdef FCG_PATH_SSE2
+        const __m128 vax = _mm_set1_ps(ax), vbx = _mm_set1_ps(bx), vcx = _mm_set1_ps(cx), vdx = _mm_set1_ps(dx);
+        const __m128 vay = _mm_set1_ps(ay), vby = _mm_set1_ps(by), vcy = _mm_set1_ps(cy), vdy = _mm_set1_ps(dy);
+        const __m128 lane = _mm_set_ps(4.0f, 3.0f, 2.0f, 1.0f);
+        for (; i + 4 <= n; i += 4)
+        {
+            __m128 t = _mm_mul_ps(_mm_add_ps(_mm_set1_ps(static_cast<float>(i)), lane), _mm_set1_ps(dt));
+            __m128 px = _mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(vax, t), vbx), t), vcx), t), vdx);
+            __m128 py = _mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(vay, t), vby), t), vcy), t), vdy);
+            // Intercala x e y: (x0 y0 x1 y1) (x2 y2 x3 y3)
+            _mm_storeu_ps(out + 2 * i, _mm_unpacklo_ps(px, py));
+            _mm_storeu_ps(out + 2 * i + 4, _mm_unpackhi_ps(px, py));
+        }
+#endif
+        for (; i < n; ++i)
+        {
+            float t = (i + 1) * dt;
+            out[2 * i] = ((ax * t + bx) * t + cx) * t + dx;
+            out[2 * i + 1] = ((ay * t + by) * t + cy) * t + dy;
+        }
+        // O último ponto é o final exato, para os contornos fecharem sem fresta
+        out[2 * (n - 1)] = batch.endX[c];
+        out[2 * (n - 1) + 1] = batch.endY[c];
+    }
+}
+
+// Achata o caminho com erro máximo de tolerancePx pixels, dado quantos pixels
+// cabem numa unidade do caminho (ex.: 400 para NDC numa janela de 800x800).
+// `batch` é só memória de trabalho; passar o mesmo entre chamadas evita alocar.
+inline void flattenPath(const Path &path, float tolerancePx, float pixelsPerUnit, FlatPath &out, CurveBatch &batch)
+{
+    out.clear();
+    batch.clear();
+
+    // 1ª passada: junta as curvas no lote
+    const float *p = path.points.data();
+    float lastX = 0.0f, lastY = 0.0f;
+    for (uint8_t verb : path.verbs)
+    {
+        switch (verb)
+        {
+        case Path::Move:
+        case Path::Line:
+            lastX = p[0];
+            lastY = p[1];
+            p += 2;
+            break;
+        case Path::Quad:
+        {
+            // Elevada a cúbica para um só caminho de avaliação; o limite usa grau 2
+            float x1 = p[0], y1 = p[1], x2 = p[2], y2 = p[3];
+            batch.addCubic(lastX, lastY, lastX + 2.0f / 3.0f * (x1 - lastX), lastY + 2.0f / 3.0f * (y1 - lastY),
+                           x2 + 2.0f / 3.0f * (x1 - x2), y2 + 2.0f / 3.0f * (y1 - y2), x2, y2, 2.0f);
+            batch.bound.push_back(std::hypot(lastX - 2.0f * x1 + x2, lastY - 2.0f * y1 + y2));
+            lastX = x2;
+            lastY = y2;
+            p += 4;
+            break;
+        }
+        case Path::Cubic:
+        {
+            float x1 = p[0], y1 = p[1], x2 = p[2], y2 = p[3], x3 = p[4], y3 = p[5];
+            batch.addCubic(lastX, lastY, x1, y1, x2, y2, x3, y3, 3.0f);
+            batch.bound.push_back(std::max(std::hypot(lastX - 2.0f * x1 + x2, lastY - 2.0f * y1 + y2),
+                                           std::hypot(x1 - 2.0f * x2 + x3, y1 - 2.0f * y2 + y3)));
+            lastX = x3;
+            lastY = y3;
+            p += 6;
+            break;
+        }
+        }
+    }
+
+    // Contagens em lote
+    pathSegmentCounts(batch, tolerancePx / pixelsPerUnit);
+
+    // 2ª passada: monta os contornos e reserva o trecho de cada curva
+    p = path.points.data();
+    size_t curve = 0;
+    bool inContour = false;
+    batch.offset.resize(batch.count.size());
+    for (uint8_t verb : path.verbs)
+    {
+        switch (verb)
+        {
+        case Path::Move:
+            out.starts.push_back(static_cast<uint32_t>(out.xy.size() / 2));
+            out.closed.push_back(0);
+            inContour = true;
+            // fall through
+        case Path::Line:
+            out.xy.push_back(p[0]);
+            out.xy.push_back(p[1]);
+            p += 2;
+            break;
+        case Path::Quad:
+        case Path::Cubic:
+            batch.offset[curve] = static_cast<uint32_t>(out.xy.size() / 2);
+            out.xy.resize(out.xy.size() + 2 * batch.count[curve]);
+            ++curve;
+            p += verb == Path::Quad ? 4 : 6;
+            break;
+        case Path::Close:
+            if (inContour)
+                out.closed.back() = 1;
+            inContour = false;
+            break;
+        }
+    }
+
+    pathEvaluate(batch, out.xy.data());
+}
+
+inline void flattenPath(const Path &path, float tolerancePx, float pixelsPerUnit, FlatPath &out)
+{
+    CurveBatch batch;
+    flattenPath(path, tolerancePx, pixelsPerUnit, out, batch);
+}
+
+// Copia um contorno sem pontos repetidos (nem o último igual ao primeiro).
+// Pontos a menos de 1e-5 unidades contam como iguais: o fim de um arco
+// completo calculado em float não cai exatamente no começo.
+inline void pathContourPoints(const FlatPath &flat, size_t c, std::vector<float> &pts)
+{
+    auto same = [](float ax, float ay, float bx, float by) {
+        return (ax - bx) * (ax - bx) + (ay - by) * (ay - by) <= 1e-10f;
+    };
+    pts.clear();
+    for (uint32_t i = flat.start(c); i < flat.end(c); ++i)
+    {
+        float x = flat.xy[2 * i], y = flat.xy[2 * i + 1];
+        size_t n = pts.size();
+        if (n >= 2 && same(pts[n - 2], pts[n - 1], x, y))
+            continue;
+        pts.push_back(x);
+        pts.push_back(y);
+    }
+    size_t n = pts.size();
+    if (n >= 4 && same(pts[0], pts[1], pts[n - 2], pts[n - 1]))
+        pts.resize(n - 2);
+}
+
+inline void pathEmit(std::vector<GLfloat> &out, float x, float y)
+{
+    out.push_back(x);
+    out.push_back(y);
+    out.push_back(0.0f);
+}
+
+// Preenchimento por contorno (não-zero não é tratado: cada contorno é um
+// polígono simples independente, sem furos). Contornos convexos viram leque;
+// os demais passam por corte de orelhas, O(n^2) no pior caso.
+inline void fillTriangles(const FlatPath &flat, std::vector<GLfloat> &out)
+{
+    std::vector<float> pts;
+    std::vector<int> next, prev;
+    for (size_t c = 0; c < flat.contourCount(); ++c)
+    {
+        pathContourPoints(flat, c, pts);
+        int n = static_cast<int>(pts.size() / 2);
+        if (n < 3)
+            continue;
+
+        auto X = [&](int i) { return pts[2 * i]; };
+        auto Y = [&](int i) { return pts[2 * i + 1]; };
+        auto cross = [&](int a, int b, int d) {
+            return (X(b) - X(a)) * (Y(d) - Y(a)) - (Y(b) - Y(a)) * (X(d) - X(a));
+        };
+
+        float area = 0.0f, perimeter = 0.0f;
+        for (int i = 0; i < n; ++i)
+        {
+            int j = (i + 1) % n;
+            area += X(i) * Y(j) - X(j) * Y(i);
+            perimeter += std::fabs(X(j) - X(i)) + std::fabs(Y(j) - Y(i));
+        }
+        // Curvas retas ou quase retas dão curvas de sinal trocado só por erro de arredondamento
+        float flat2 = 1e-7f * perimeter * perimeter / (n * n);
+        bool hasLeft = false, hasRight = false;
+        for (int i = 0; i < n; ++i)
+        {
+            float turn = cross(i, (i + 1) % n, (i + 2) % n);
+            hasLeft |= turn > flat2;
+            hasRight |= turn < -flat2;
+        }
+        if (!(hasLeft && hasRight))
+        {
+            for (int i = 1; i + 1 < n; ++i)
+            {
+                pathEmit(out, X(0), Y(0));
+                pathEmit(out, X(i), Y(i));
+                pathEmit(out, X(i + 1), Y(i + 1));
+            }
+            continue;
+        }
+
+        float orientation = area > 0.0f ? 1.0f : -1.0f;
+        next.resize(n);
+        prev.resize(n);
+        for (int i = 0; i < n; ++i)
+        {
+            next[i] = (i + 1) % n;
+            prev[i] = (i + n - 1) % n;
+        }
+        int remaining = n, current = 0, misses = 0;
+        while (remaining > 3 && misses < remaining)
+        {
+            int a = prev[current], b = current, d = next[current];
+            bool ear = cross(a, b, d) * orientation > 0.0f;
+            for (int q = next[d]; ear && q != a; q = next[q])
+            {
+                // Ponto dentro (ou na borda) do triângulo candidato
+                if (cross(a, b, q) * orientation >= 0.0f && cross(b, d, q) * orientation >= 0.0f &&
+                    cross(d, a, q) * orientation >= 0.0f)
+                    ear = false;
+            }
+            if (ear)
+            {
+                pathEmit(out, X(a), Y(a));
+                pathEmit(out, X(b), Y(b));
+                pathEmit(out, X(d), Y(d));
+                next[a] = d;
+                prev[d] = a;
+                --remaining;
+                misses = 0;
+                current = d;
+            }
+            else
+            {
+                ++misses;
+                current = d;
+            }
+        }
+        // O que sobrar (3 vértices, ou um polígono degenerado) vai em leque
+        for (int q = next[next[current]]; remaining >= 3 && q != current; q = next[q])
+        {
+            pathEmit(out, X(current), Y(current));
+            pathEmit(out, X(prev[q]), Y(prev[q]));
+            pathEmit(out, X(q), Y(q));
+        }
+    }
+}
+
+// Contorno com espessura 2*halfWidth: dois triângulos por segmento, juntas em
+// esquadria (limitada a miterLimit vezes a meia espessura), pontas retas.
+inline void strokeTriangles(const FlatPath &flat, float halfWidth, std::vector<GLfloat> &out, float miterLimit = 4.0f)
+{
+    std::vector<float> pts, offsets;
+    for (size_t c = 0; c < flat.contourCount(); ++c)
+    {
+        pathContourPoints(flat, c, pts);
+        int n = static_cast<int>(pts.size() / 2);
+        if (n < 2)
+            continue;
+        bool closed = flat.closed[c] && n > 2;
+
+        // Normal de cada segmento
+        int segments = closed ? n : n - 1;
+        std::vector<float> normals(2 * segments);
+        for (int s = 0; s < segments; ++s)
+        {
+            int e = (s + 1) % n;
+            float dx = pts[2 * e] - pts[2 * s], dy = pts[2 * e + 1] - pts[2 * s + 1];
+            float len = std::sqrt(dx * dx + dy * dy);
+            normals[2 * s] = -dy / len;
+            normals[2 * s + 1] = dx / len;
+        }
+
+        // Deslocamento de cada vértice: média das normais vizinhas, esticada
+        offsets.assign(2 * n, 0.0f);
+        for (int i = 0; i < n; ++i)
+        {
+            int before = closed ? (i + segments - 1) % segments : std::max(i - 1, 0);
+            int after = closed ? i % segments : std::min(i, segments - 1);
+            float mx = normals[2 * before] + normals[2 * after];
+            float my = normals[2 * before + 1] + normals[2 * after + 1];
+            float len = std::sqrt(mx * mx + my * my);
+            if (len < 1e-6f)
+            {
+                mx = normals[2 * after];
+                my = normals[2 * after + 1];
+                len = 1.0f;
+            }
+            mx /= len;
+            my /= len;
+            float cosHalf = mx * normals[2 * after] + my * normals[2 * after + 1];
+            float scale = halfWidth / std::max(cosHalf, 1.0f / miterLimit);
+            offsets[2 * i] = mx * scale;
+            offsets[2 * i + 1] = my * scale;
+        }
+
+        for (int s = 0; s < segments; ++s)
+        {
+            int e = (s + 1) % n;
+            float ax = pts[2 * s], ay = pts[2 * s + 1], bx = pts[2 * e], by = pts[2 * e + 1];
+            float aox = offsets[2 * s], aoy = offsets[2 * s + 1], box = offsets[2 * e], boy = offsets[2 * e + 1];
+            pathEmit(out, ax + aox, ay + aoy);
+            pathEmit(out, ax - aox, ay - aoy);
+            pathEmit(out, bx + box, by + boy);
+            pathEmit(out, bx + box, by + boy);
+            pathEmit(out, ax - aox, ay - aoy);
+            pathEmit(out, bx - box, by - boy);
+        }
+    }
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+#include <glad/glad.h>
+
+#include "ShaderProgram.h"
+
+// Programas de shader indexados pelo texto dos estágios: pedir de novo o mesmo
+// par vertex/fragment devolve o programa já linkado, sem compilar. Quem é dono
+// do cache (o host de cenas, por exemplo) mantém os programas vivos entre
+// cenas; quem só usa não deve apagá-los.
+//
+//   GLuint prog = cache.get(vsSrc, fsSrc);   // 0 se não compilou
+class ProgramCache
+{
+public:
+    GLuint get(const GLchar *vertexSrc, const GLchar *fragmentSrc)
+    {
+        std::string key = std::string(vertexSrc) + '\0' + fragmentSrc;
+        auto it = programs.find(key);
+        if (it != programs.end())
+        {
+            ++hitCount;
+            return it->second;
+        }
+        ++missCount;
+        GLuint prog = linkProgram(vertexSrc, fragmentSrc, "ProgramCache");
+        if (prog)
+            programs.emplace(std::move(key), prog);
+        return prog;
+    }
+
+    uint64_t hits() const { return hitCount; }
+    uint64_t misses() const { return missCount; }
+    size_t size() const { return programs.size(); }
+
+    void release()
+    {
+        for (auto &entry : programs)
+            glDeleteProgram(entry.second);
+        programs.clear();
+    }
+
+private:
+    std::unordered_map<std::string, GLuint> programs;
+    uint64_t hitCount = 0, missCount = 0;
+};
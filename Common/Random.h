@@ -0,0 +1,131 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// Geradores pseudoaleatórios rápidos e com semente, para quem precisa de
+// muitos números por quadro (std::random_device custa uma chamada ao sistema
+// e std::mt19937 carrega 2,5 KB de estado).
+//
+// Xoshiro128 é o xoshiro128+ de Blackman e Vigna: 16 bytes de estado, período
+// 2^128 - 1; os 24 bits altos viram um float em [0, 1). Xoshiro128x8 roda oito
+// geradores independentes lado a lado (estrutura de arrays): o laço de fill()
+// só tem somas, xors e deslocamentos de uint32_t em arrays de 8, e o compilador
+// o transforma em instruções SIMD (SSE2/AVX2/NEON) sem intrínsecos.
+
+// splitmix64: espalha uma semente pequena (0, 1, 2...) em estado bem misturado
+inline uint64_t splitmix64(uint64_t &x)
+{
+    uint64_t z = (x += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+inline uint32_t rotl32(uint32_t x, int k) { return (x << k) | (x >> (32 - k)); }
+
+// [0, 1) a partir dos 24 bits altos
+inline float unitFloat(uint32_t x) { return static_cast<float>(x >> 8) * (1.0f / 16777216.0f); }
+
+struct Xoshiro128
+{
+    uint32_t s[4];
+
+    explicit Xoshiro128(uint64_t seed = 1) { reseed(seed); }
+
+    void reseed(uint64_t seed)
+    {
+        uint64_t a = splitmix64(seed), b = splitmix64(seed);
+        s[0] = static_cast<uint32_t>(a);
+        s[1] = static_cast<uint32_t>(a >> 32);
+        s[2] = static_cast<uint32_t>(b);
+        s[3] = static_cast<uint32_t>(b >> 32);
+    }
+
+    uint32_t next()
+    {
+        uint32_t result = s[0] + s[3];
+        uint32_t t = s[1] << 9;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = rotl32(s[3], 11);
+        return result;
+    }
+
+    float uniform() { return unitFloat(next()); }
+    float uniform(float lo, float hi) { return lo + (hi - lo) * uniform(); }
+};
+
+class Xoshiro128x8
+{
+public:
+    static const int LANES = 8;
+
+    explicit Xoshiro128x8(uint64_t seed = 1) { reseed(seed); }
+
+    // Cada pista recebe sua própria sequência da mesma semente
+    void reseed(uint64_t seed)
+    {
+        for (int l = 0; l < LANES; ++l)
+        {
+            uint64_t a = splitmix64(seed), b = splitmix64(seed);
+            s0[l] = static_cast<uint32_t>(a);
+            s1[l] = static_cast<uint32_t>(a >> 32);
+            s2[l] = static_cast<uint32_t>(b);
+            s3[l] = static_cast<uint32_t>(b >> 32);
+        }
+        spare = LANES;
+    }
+
+    // n floats uniformes em [lo, hi). A sequência só depende da semente, não de
+    // como os pedidos foram divididos: o resto de um bloco fica para o próximo.
+    void fill(float *out, size_t n, float lo = 0.0f, float hi = 1.0f)
+    {
+        float scale = hi - lo;
+        while (n > 0 && spare < LANES)
+        {
+            *out++ = lo + scale * block[spare++];
+            --n;
+        }
+        while (n >= LANES)
+        {
+            step(out);
+            for (int l = 0; l < LANES; ++l)
+                out[l] = lo + scale * out[l];
+            out += LANES;
+            n -= LANES;
+        }
+        if (n > 0)
+        {
+            step(block);
+            for (spare = 0; n > 0; --n)
+                *out++ = lo + scale * block[spare++];
+        }
+    }
+
+private:
+    // Um passo das oito pistas
+    void step(float *out)
+    {
+        for (int l = 0; l < LANES; ++l)
+        {
+            uint32_t result = s0[l] + s3[l];
+            uint32_t t = s1[l] << 9;
+            s2[l] ^= s0[l];
+            s3[l] ^= s1[l];
+            s1[l] ^= s2[l];
+            s0[l] ^= s3[l];
+            s2[l] ^= t;
+            s3[l] = rotl32(s3[l], 11);
+            out[l] = unitFloat(result);
+        }
+    }
+
+    alignas(32) uint32_t s0[LANES], s1[LANES], s2[LANES], s3[LANES];
+    float block[LANES];
+    int spare = LANES; // próximo número não usado de block
+};
@@ -0,0 +1,177 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <glad/glad.h>
+
+#include "Color.h"
+#include "ShaderProgram.h"
+
+// Retângulos alinhados aos eixos como instâncias: cada um ocupa 24 bytes
+// (x0, y0, x1, y1, cor RGBA8, largura da borda) num buffer de instâncias e o
+// vertex shader expande os 4 cantos a partir de gl_VertexID. Um retângulo de
+// dois triângulos em VAO próprio custa 72 bytes e um draw; aqui um lote inteiro
+// é um draw só.
+//
+//   RectBatch rects;  rects.init();
+//   rects.add(-0.5f, -0.5f, 0.5f, 0.5f, canvasColor(1, 1, 0), 0.02f);
+//   rects.draw();                       // reenvia só se algo mudou
+//
+// A borda fica por dentro do retângulo, nas mesmas unidades das coordenadas, e
+// usa borderColor (uma cor para o lote todo). Cores no formato de canvasColor().
+struct RectInstance
+{
+    float x0, y0, x1, y1;
+    uint32_t color;
+    float border;
+};
+
+class RectBatch
+{
+public:
+    float borderColor[4] = {0.0f, 0.0f, 0.0f, 1.0f};
+    // Matriz 4x4 por colunas (identidade = NDC)
+    float transform[16] = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1};
+
+    bool init()
+    {
+        program = link();
+        if (!program)
+            return false;
+        glGenVertexArrays(1, &vao);
+        glGenBuffers(1, &vbo);
+        glBindVertexArray(vao);
+        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, sizeof(RectInstance), (GLvoid *)0);
+        glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(RectInstance), (GLvoid *)(4 * sizeof(float)));
+        glVertexAttribPointer(2, 1, GL_FLOAT, GL_FALSE, sizeof(RectInstance), (GLvoid *)(5 * sizeof(float)));
+        for (GLuint i = 0; i < 3; ++i)
+        {
+            glEnableVertexAttribArray(i);
+            glVertexAttribDivisor(i, 1);
+        }
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindVertexArray(0);
+        return true;
+    }
+
+    // Devolve o índice do retângulo, para usar em draw(first, count)
+    size_t add(float x0, float y0, float x1, float y1, uint32_t color, float border = 0.0f)
+    {
+        rects.push_back({x0, y0, x1, y1, color, border});
+        dirty = true;
+        return rects.size() - 1;
+    }
+
+    RectInstance &operator[](size_t i)
+    {
+        dirty = true;
+        return rects[i];
+    }
+
+    size_t size() const { return rects.size(); }
+
+    void clear()
+    {
+        rects.clear();
+        dirty = true;
+    }
+
+    // Desenha os retângulos [first, first + count); count < 0 vai até o fim
+    void draw(size_t first = 0, long count = -1)
+    {
+        if (dirty)
+            upload();
+        size_t n = count < 0 ? rects.size() - first : static_cast<size_t>(count);
+        if (n == 0)
+            return;
+        GLint previous;
+        glGetIntegerv(GL_CURRENT_PROGRAM, &previous);
+        glUseProgram(program);
+        glUniformMatrix4fv(glGetUniformLocation(program, "transform"), 1, GL_FALSE, transform);
+        glUniform4fv(glGetUniformLocation(program, "borderColor"), 1, borderColor);
+        glBindVertexArray(vao);
+        // Sem glDrawArraysInstancedBaseInstance (GL 4.2): o deslocamento vai nos ponteiros
+        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        GLintptr base = static_cast<GLintptr>(first * sizeof(RectInstance));
+        glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, sizeof(RectInstance), (GLvoid *)base);
+        glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(RectInstance), (GLvoid *)(base + 4 * sizeof(float)));
+        glVertexAttribPointer(2, 1, GL_FLOAT, GL_FALSE, sizeof(RectInstance), (GLvoid *)(base + 5 * sizeof(float)));
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, static_cast<GLsizei>(n));
+        glBindVertexArray(0);
+        glUseProgram(previous);
+    }
+
+    void release()
+    {
+        glDeleteProgram(program);
+        glDeleteBuffers(1, &vbo);
+        glDeleteVertexArrays(1, &vao);
+        program = vbo = vao = 0;
+    }
+
+private:
+    void upload()
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        size_t bytes = rects.size() * sizeof(RectInstance);
+        if (bytes > capacity)
+        {
+            capacity = bytes;
+            glBufferData(GL_ARRAY_BUFFER, capacity, rects.data(), GL_DYNAMIC_DRAW);
+        }
+        else
+        {
+            glBufferSubData(GL_ARRAY_BUFFER, 0, bytes, rects.data());
+        }
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        dirty = false;
+    }
+
+    static GLuint link()
+    {
+        static const GLchar *vsText = R"(
+ #version 400
+ layout (location = 0) in vec4 rect;       // x0, y0, x1, y1
+ layout (location = 1) in vec4 rectColor;
+ layout (location = 2) in float rectBorder;
+ uniform mat4 transform;
+ out vec2 local;
+ flat out vec4 bounds;
+ flat out vec4 fill;
+ flat out float border;
+ void main()
+ {
+	 // Faixa de triângulos: (0,0) (1,0) (0,1) (1,1)
+	 vec2 corner = vec2(gl_VertexID & 1, gl_VertexID >> 1);
+	 local = mix(rect.xy, rect.zw, corner);
+	 bounds = vec4(min(rect.xy, rect.zw), max(rect.xy, rect.zw));
+	 fill = rectColor;
+	 border = rectBorder;
+	 gl_Position = transform * vec4(local, 0.0, 1.0);
+ }
+ )";
+        static const GLchar *fsText = R"(
+ #version 400
+ in vec2 local;
+ flat in vec4 bounds;
+ flat in vec4 fill;
+ flat in float border;
+ uniform vec4 borderColor;
+ out vec4 color;
+ void main()
+ {
+	 vec2 inside = min(local - bounds.xy, bounds.zw - local);
+	 color = min(inside.x, inside.y) < border ? borderColor : fill;
+ }
+ )";
+        return linkProgram(vsText, fsText, "RectBatch");
+    }
+
+    GLuint program = 0, vao = 0, vbo = 0;
+    std::vector<RectInstance> rects;
+    size_t capacity = 0;
+    bool dirty = true;
+};
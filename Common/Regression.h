@@ -0,0 +1,303 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include "StbImage.h"
+#include "StbImageWrite.h"
+
+// Modo de regressão (imagem de referência + desempenho).
+//
+// Desligado por padrão. Com FCG_REGRESSION_FRAMES=N o programa abre a janela
+// invisível, desenha N quadros sem vsync, lê o último quadro e compara com a
+// imagem de referência <FCG_GOLDEN_DIR>/<nome>.png. As estatísticas de tempo
+// por quadro (com glFinish, então incluem o desenho e não só o envio) vão para
+// o arquivo FCG_RESULTS (CSV, uma linha por execução) e a mediana é comparada
+// com <FCG_GOLDEN_DIR>/<nome>.perf. Sem a imagem ou o tempo de referência a
+// execução falha (status sem-referencia); com FCG_REGRESSION_BLESS=1 as duas
+// referências são gravadas (ou regravadas) a partir desta execução e ela passa.
+//
+// Variáveis opcionais:
+//   FCG_GOLDEN_DIR       pasta das referências (padrão: golden)
+//   FCG_RESULTS          arquivo de resultados (padrão: regressao.csv)
+//   FCG_PIXEL_TOLERANCE  diferença máxima por canal, 0..255 (padrão: 2)
+//   FCG_PIXEL_MAX_DIFF   fração máxima de pixels fora da tolerância (padrão: 0.001)
+//   FCG_PERF_TOLERANCE   piora máxima da mediana, em fração (padrão: 0.25)
+//   FCG_PERF_SLACK_MS    piora mínima aceita, em ms, para medianas muito curtas
+//                        (padrão: 0.02); o limite é a referência mais o maior
+//                        entre referência * FCG_PERF_TOLERANCE e esta folga
+//   FCG_PERF_WINDOWS     janelas de N quadros medidas enquanto a mediana passar
+//                        do limite; vale a de menor mediana (padrão: 3). Uma
+//                        piora do código aparece em todas, a de outro processo
+//                        disputando a CPU raramente. Com BLESS mede todas
+//   FCG_REGRESSION_BLESS 1 grava as referências em vez de comparar
+//
+// Sem display, rodar dentro de um servidor X virtual (ex.: xvfb-run) ou com
+// o Mesa em modo llvmpipe.
+//
+// Uso em cada programa:
+//   glfwInit();
+//   regressionInit("Lista1_Exercicio9");   // antes do glfwCreateWindow
+//   ...
+//   regressionFrame(window);               // no loop, antes do glfwSwapBuffers
+//   ...
+//   return regressionResult();
+
+// Estatísticas simples sobre os tempos por quadro (ms)
+struct FrameStats
+{
+    double mean = 0, median = 0, p95 = 0, max = 0;
+};
+
+struct RegressionState
+{
+    bool enabled = false;
+    std::string name;
+    int frames = 0;
+    int frame = 0;
+    std::chrono::steady_clock::time_point last;
+    std::vector<double> frameMs;
+    int result = 0;
+    std::string status = "ok";
+    double diffFraction = -1.0;
+    int window = 0; // janela de medição atual, até FCG_PERF_WINDOWS
+    FrameStats best; // a janela de menor mediana
+};
+
+inline RegressionState &regressionState()
+{
+    static RegressionState state;
+    return state;
+}
+
+inline bool regressionEnabled() { return regressionState().enabled; }
+
+inline std::string regressionEnv(const char *key, const char *fallback)
+{
+    const char *v = std::getenv(key);
+    return v && *v ? std::string(v) : std::string(fallback);
+}
+
+inline void regressionInit(const char *name)
+{
+    RegressionState &s = regressionState();
+    s.name = name;
+    s.frames = std::atoi(regressionEnv("FCG_REGRESSION_FRAMES", "0").c_str());
+    s.enabled = s.frames > 0;
+    if (s.enabled)
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+}
+
+inline FrameStats regressionStats(std::vector<double> ms)
+{
+    FrameStats st;
+    if (ms.empty())
+        return st;
+    std::sort(ms.begin(), ms.end());
+    for (double v : ms)
+        st.mean += v;
+    st.mean /= ms.size();
+    st.median = ms[ms.size() / 2];
+    st.p95 = ms[std::min(ms.size() - 1, static_cast<size_t>(ms.size() * 0.95))];
+    st.max = ms.back();
+    return st;
+}
+
+// Compara o quadro (lido de baixo para cima, como sai da glReadPixels) com a
+// referência (PNG, de cima para baixo); devolve a fração de pixels diferentes
+// ou -1 se a referência não existir/tiver outro tamanho
+inline double regressionCompare(const std::string &goldenPath, const std::vector<unsigned char> &pixels,
+                                int w, int h, int tolerance, std::vector<unsigned char> &diff)
+{
+    int gw, gh;
+    unsigned char *golden = stbi_load(goldenPath.c_str(), &gw, &gh, nullptr, 4);
+    if (!golden)
+        return -1.0;
+    if (gw != w || gh != h)
+    {
+        stbi_image_free(golden);
+        return -1.0;
+    }
+
+    size_t bad = 0;
+    diff.assign(pixels.size(), 0);
+    for (size_t p = 0; p < static_cast<size_t>(w) * h; ++p)
+    {
+        size_t g = ((h - 1 - p / w) * w + p % w) * 4;
+        int worst = 0;
+        for (int c = 0; c < 3; ++c)
+            worst = std::max(worst, std::abs(int(pixels[p * 4 + c]) - int(golden[g + c])));
+        if (worst > tolerance)
+        {
+            ++bad;
+            diff[p * 4] = 255;
+        }
+        diff[p * 4 + 3] = 255;
+    }
+    stbi_image_free(golden);
+    return double(bad) / (double(w) * h);
+}
+
+// Lê o último quadro e compara com a referência (ou a grava)
+inline void regressionCheckImage(GLFWwindow *window)
+{
+    RegressionState &s = regressionState();
+    std::string dir = regressionEnv("FCG_GOLDEN_DIR", "golden");
+    std::string goldenPath = dir + "/" + s.name + ".png";
+    int tolerance = std::atoi(regressionEnv("FCG_PIXEL_TOLERANCE", "2").c_str());
+    double maxDiff = std::atof(regressionEnv("FCG_PIXEL_MAX_DIFF", "0.001").c_str());
+    bool bless = regressionEnv("FCG_REGRESSION_BLESS", "0") == "1";
+
+    // Lê o buffer de trás (o quadro que seria apresentado agora)
+    int w, h;
+    glfwGetFramebufferSize(window, &w, &h);
+    std::vector<unsigned char> pixels(static_cast<size_t>(w) * h * 4);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadBuffer(GL_BACK);
+    glReadPixels(0, 0, w, h, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+    stbi_flip_vertically_on_write(1);
+
+    std::filesystem::create_directories(dir);
+    std::vector<unsigned char> diff;
+    s.diffFraction = bless ? -1.0 : regressionCompare(goldenPath, pixels, w, h, tolerance, diff);
+    if (bless)
+    {
+        stbi_write_png(goldenPath.c_str(), w, h, 4, pixels.data(), w * 4);
+        std::cout << "[regressao] referencia gravada em " << goldenPath << std::endl;
+        s.status = "nova-referencia";
+        s.diffFraction = 0.0;
+    }
+    else if (s.diffFraction < 0.0)
+    {
+        stbi_write_png((s.name + "_atual.png").c_str(), w, h, 4, pixels.data(), w * 4);
+        std::cerr << "[regressao] " << s.name << ": sem referencia em " << goldenPath
+                  << " (ou de outro tamanho); FCG_REGRESSION_BLESS=1 grava uma nova" << std::endl;
+        s.status = "sem-referencia";
+        s.result = 1;
+    }
+    else if (s.diffFraction > maxDiff)
+    {
+        stbi_write_png((s.name + "_atual.png").c_str(), w, h, 4, pixels.data(), w * 4);
+        stbi_write_png((s.name + "_diff.png").c_str(), w, h, 4, diff.data(), w * 4);
+        std::cerr << "[regressao] " << s.name << ": " << s.diffFraction * 100.0
+                  << "% dos pixels diferem da referencia" << std::endl;
+        s.status = "imagem-diferente";
+        s.result = 1;
+    }
+}
+
+// Fecha uma janela de medição (a primeira também confere a imagem). Devolve
+// false se outra janela deve ser medida, true quando o resultado está pronto.
+inline bool regressionFinish(GLFWwindow *window)
+{
+    RegressionState &s = regressionState();
+    std::string perfPath = regressionEnv("FCG_GOLDEN_DIR", "golden") + "/" + s.name + ".perf";
+    double perfTolerance = std::atof(regressionEnv("FCG_PERF_TOLERANCE", "0.25").c_str());
+    double perfSlack = std::atof(regressionEnv("FCG_PERF_SLACK_MS", "0.02").c_str());
+    int windows = std::max(1, std::atoi(regressionEnv("FCG_PERF_WINDOWS", "3").c_str()));
+    bool bless = regressionEnv("FCG_REGRESSION_BLESS", "0") == "1";
+
+    if (s.window == 0)
+        regressionCheckImage(window);
+
+    // O primeiro quadro inclui compilação de shaders etc., então fica de fora
+    FrameStats st = regressionStats(std::vector<double>(s.frameMs.begin() + (s.frameMs.size() > 1 ? 1 : 0),
+                                                        s.frameMs.end()));
+    if (s.window == 0 || st.median < s.best.median)
+        s.best = st;
+
+    double baseline = 0.0;
+    bool hasBaseline = false;
+    if (FILE *f = bless ? nullptr : std::fopen(perfPath.c_str(), "r"))
+    {
+        hasBaseline = std::fscanf(f, "%lf", &baseline) == 1;
+        std::fclose(f);
+    }
+    bool slow = hasBaseline && baseline > 0.0 && s.best.median > baseline + std::max(baseline * perfTolerance, perfSlack);
+    if (++s.window < windows && (bless || slow))
+    {
+        s.frameMs.clear();
+        return false;
+    }
+
+    if (slow)
+    {
+        std::cerr << "[regressao] " << s.name << ": mediana " << s.best.median << " ms contra " << baseline
+                  << " ms de referencia (melhor de " << s.window << " janelas)" << std::endl;
+        if (s.result == 0)
+            s.status = "desempenho";
+        s.result = 1;
+    }
+    else if (!bless && !hasBaseline)
+    {
+        std::cerr << "[regressao] " << s.name << ": sem tempo de referencia em " << perfPath << std::endl;
+        if (s.result == 0)
+            s.status = "sem-referencia";
+        s.result = 1;
+    }
+    else if (bless)
+    {
+        if (FILE *out = std::fopen(perfPath.c_str(), "w"))
+        {
+            std::fprintf(out, "%.4f\n", s.best.median);
+            std::fclose(out);
+        }
+    }
+
+    std::string resultsPath = regressionEnv("FCG_RESULTS", "regressao.csv");
+    bool header = true;
+    if (FILE *probe = std::fopen(resultsPath.c_str(), "r"))
+    {
+        header = false;
+        std::fclose(probe);
+    }
+    if (FILE *out = std::fopen(resultsPath.c_str(), "a"))
+    {
+        const FrameStats &b = s.best;
+        if (header)
+            std::fprintf(out, "programa,quadros,media_ms,mediana_ms,p95_ms,max_ms,pixels_diferentes,status\n");
+        std::fprintf(out, "%s,%d,%.4f,%.4f,%.4f,%.4f,%.6f,%s\n", s.name.c_str(), s.frames, b.mean, b.median, b.p95,
+                     b.max, s.diffFraction, s.status.c_str());
+        std::fclose(out);
+    }
+    return true;
+}
+
+// Chamar uma vez por quadro, antes do glfwSwapBuffers. No último quadro faz a
+// comparação e pede o fechamento da janela (ou mede outra janela de quadros).
+inline void regressionFrame(GLFWwindow *window)
+{
+    RegressionState &s = regressionState();
+    if (!s.enabled)
+        return;
+
+    // Sem o glFinish o tempo seria só o de enviar os comandos: a GPU (ou o
+    // llvmpipe) ainda estaria desenhando o quadro quando o relógio fosse lido
+    glFinish();
+    auto now = std::chrono::steady_clock::now();
+    if (s.frame == 0)
+        glfwSwapInterval(0); // sem vsync, senão o tempo medido é só a espera do monitor
+    else
+        s.frameMs.push_back(std::chrono::duration<double, std::milli>(now - s.last).count());
+    s.last = now;
+
+    if (++s.frame >= s.frames)
+    {
+        if (regressionFinish(window))
+            glfwSetWindowShouldClose(window, GL_TRUE);
+        else
+            s.frame = 1; // a imagem já foi conferida; só os tempos de novo
+    }
+}
+
+// Código de saída do programa: diferente de zero se a regressão falhou
+inline int regressionResult() { return regressionState().result; }
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h> // só as constantes GLFW_KEY_*; a cena não chama a GLFW
+
+#include "GLLoader.h"
+#include "ProgramCache.h"
+
+// Interface de cena para o SceneHost (src/Scenes): o que um exercício faz em
+// setupShader/setupGeometry vai para init(), o corpo do laço (sem poll nem
+// swap) para frame() e o key_callback para key(). Cada cena é compilada como
+// biblioteca compartilhada e exporta as funções de FCG_SCENE; o host mantém a
+// janela, o contexto e o cache de programas entre as trocas.
+//
+// A cena não chama a GLFW: a biblioteca estática da GLFW do host não é a
+// mesma cópia que a cena enxergaria. Tudo o que ela precisa chega pelo
+// SceneContext. Os ponteiros OpenGL da cena são carregados pelo carregador
+// mínimo (GLLoader.h) na criação, com a glfwGetProcAddress do host.
+const int FCG_SCENE_API = 1;
+
+struct SceneContext
+{
+    int width = 0, height = 0; // framebuffer
+    double time = 0.0, dt = 0.0;
+    ProgramCache *programs = nullptr; // do host; a cena não apaga estes programas
+};
+
+class Scene
+{
+public:
+    virtual ~Scene() {}
+    virtual const char *name() const = 0;
+    // Shaders (pelo cache) e geometria; false aborta a troca
+    virtual bool init(SceneContext &ctx) = 0;
+    virtual void frame(SceneContext &ctx) = 0;
+    // Teclas que o host não usa (códigos GLFW_KEY_*, ações GLFW_PRESS etc.)
+    virtual void key(int key, int action) {}
+    // Apaga VAOs, VBOs e texturas criados em init()
+    virtual void release() = 0;
+};
+
+#ifdef _WIN32
+#define FCG_SCENE_EXPORT extern "C" __declspec(dllexport)
+#else
+#define FCG_SCENE_EXPORT extern "C" __attribute__((visibility("default")))
+#endif
+
+typedef int (*FcgSceneApiFn)();
+typedef Scene *(*FcgCreateSceneFn)(GLADloadproc);
+typedef void (*FcgDestroySceneFn)(Scene *);
+
+// Uma vez por biblioteca de cena, depois da classe:  FCG_SCENE(CircleScene)
+#define FCG_SCENE(Class)                                            \
+    FCG_SCENE_EXPORT int fcgSceneApi() { return FCG_SCENE_API; }    \
+    FCG_SCENE_EXPORT Scene *fcgCreateScene(GLADloadproc load)       \
+    {                                                               \
+        return loadGL(load) ? new Class : nullptr;                  \
+    }                                                               \
+    FCG_SCENE_EXPORT void fcgDestroyScene(Scene *scene) { delete scene; }
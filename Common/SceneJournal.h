@@ -0,0 +1,373 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "MappedFile.h"
+
+// Diário de edições de uma cena de triângulos com snapshots compactados.
+//
+// Cada edição (adicionar, apagar, mudar a cor) vira um registro de 40 bytes
+// acrescentado a prefixo.journal.<geração>, por um FILE* com buffer grande:
+// escrita sequencial, sem seek nem reescrita. flush() (uma vez por quadro)
+// entrega o buffer ao sistema, então um crash do programa perde no máximo as
+// edições do quadro corrente.
+//
+// Quando o diário passa de compactEvery registros, snapshot() grava a cena
+// inteira em prefixo.snapshot numa thread: o diário atual é fechado, um novo
+// (geração seguinte) começa na hora e o snapshot registra a geração que ele
+// cobre. Só depois de o snapshot ter sido renomeado por cima do anterior os
+// diários antigos são apagados; um crash no meio deixa o snapshot velho e os
+// diários que ele não cobre, e nada se perde.
+//
+// Na abertura, o snapshot é mapeado (MappedFile) e entregue de uma vez; só os
+// diários de geração maior são reaplicados, então a recuperação é limitada
+// por compactEvery e não pelo tamanho da sessão. Um registro final cortado
+// (checksum errado ou tamanho incompleto) encerra a leitura daquele diário.
+//
+// Formato do snapshot (little-endian, pensado para ser usado direto do mmap):
+//   SceneSnapshotHeader (64 bytes) + count * SceneRecord (32 bytes cada)
+
+struct SceneRecord
+{
+    uint32_t id;
+    uint32_t color; // RGBA8, como canvasColor()
+    float xy[6];
+};
+
+enum SceneOpType : uint32_t
+{
+    SCENE_OP_ADD = 1,
+    SCENE_OP_DELETE = 2,
+    SCENE_OP_RECOLOR = 3
+};
+
+struct SceneOp
+{
+    uint32_t type;
+    SceneRecord record; // DELETE usa só o id; RECOLOR, id e cor
+    uint32_t check;
+};
+
+struct SceneSnapshotHeader
+{
+    char magic[8];      // "FCGSCENE"
+    uint32_t version;
+    uint32_t recordSize;
+    uint64_t count;
+    uint64_t generation; // diários com geração <= esta já estão incluídos
+    uint32_t nextId;
+    uint32_t reserved[7];
+};
+
+struct SceneJournalHeader
+{
+    char magic[8]; // "FCGJRNL1"
+    uint64_t generation;
+};
+
+static_assert(sizeof(SceneRecord) == 32, "SceneRecord precisa de 32 bytes");
+static_assert(sizeof(SceneOp) == 40, "SceneOp precisa de 40 bytes");
+static_assert(sizeof(SceneSnapshotHeader) == 64, "SceneSnapshotHeader precisa de 64 bytes");
+
+// FNV-1a dos bytes antes do campo check
+inline uint32_t sceneOpChecksum(const SceneOp &op)
+{
+    const unsigned char *p = reinterpret_cast<const unsigned char *>(&op);
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < offsetof(SceneOp, check); ++i)
+        h = (h ^ p[i]) * 16777619u;
+    return h;
+}
+
+// Grava em path.tmp, força para o disco e renomeia por cima de path
+inline bool sceneWriteSnapshot(const std::string &path, const SceneRecord *records, size_t count,
+                               uint64_t generation, uint32_t nextId)
+{
+    std::string tmp = path + ".tmp";
+    FILE *f = std::fopen(tmp.c_str(), "wb");
+    if (!f)
+        return false;
+    SceneSnapshotHeader h = {};
+    std::memcpy(h.magic, "FCGSCENE", 8);
+    h.version = 1;
+    h.recordSize = sizeof(SceneRecord);
+    h.count = count;
+    h.generation = generation;
+    h.nextId = nextId;
+    bool ok = std::fwrite(&h, sizeof(h), 1, f) == 1 &&
+              (count == 0 || std::fwrite(records, sizeof(SceneRecord), count, f) == count);
+    ok = std::fflush(f) == 0 && ok;
+#ifdef _WIN32
+    ok = _commit(_fileno(f)) == 0 && ok;
+#else
+    ok = fsync(fileno(f)) == 0 && ok;
+#endif
+    ok = std::fclose(f) == 0 && ok;
+    std::error_code ec;
+    if (ok)
+        std::filesystem::rename(tmp, path, ec);
+    if (!ok || ec)
+    {
+        std::filesystem::remove(tmp, ec);
+        return false;
+    }
+    return true;
+}
+
+class SceneJournal
+{
+public:
+    size_t compactEvery = 1 << 16; // registros no diário antes de pedir snapshot
+
+    ~SceneJournal() { close(); }
+
+    // onSnapshot(const SceneRecord *records, size_t count) recebe a cena do
+    // snapshot (memória mapeada, válida só durante a chamada) e onOp(const
+    // SceneOp &) cada edição posterior, em ordem
+    template <class OnSnapshot, class OnOp>
+    bool open(const std::string &pathPrefix, OnSnapshot onSnapshot, OnOp onOp)
+    {
+        close();
+        prefix = pathPrefix;
+        auto start = std::chrono::steady_clock::now();
+
+        uint64_t covered = 0;
+        replayed = 0;
+        loadedRecords = 0;
+        {
+            MappedFile map;
+            if (map.open(prefix + ".snapshot") && map.size() >= sizeof(SceneSnapshotHeader))
+            {
+                SceneSnapshotHeader h;
+                std::memcpy(&h, map.data(), sizeof(h));
+                if (std::memcmp(h.magic, "FCGSCENE", 8) == 0 && h.recordSize == sizeof(SceneRecord) &&
+                    sizeof(h) + h.count * sizeof(SceneRecord) <= map.size())
+                {
+                    onSnapshot(reinterpret_cast<const SceneRecord *>(map.data() + sizeof(h)), static_cast<size_t>(h.count));
+                    covered = h.generation;
+                    storedNextId = h.nextId;
+                    loadedRecords = static_cast<size_t>(h.count);
+                }
+                else
+                {
+                    std::cerr << "SceneJournal: " << prefix << ".snapshot invalido, ignorado" << std::endl;
+                }
+            }
+        }
+
+        uint64_t last = covered;
+        for (uint64_t gen : generations())
+        {
+            if (gen <= covered)
+            {
+                std::error_code ec;
+                std::filesystem::remove(journalPath(gen), ec); // sobra de um snapshot que terminou
+                continue;
+            }
+            replayed += replay(gen, onOp);
+            last = gen;
+        }
+        opsSinceSnapshot = replayed;
+        generation = last + 1;
+        replayMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        return startJournal();
+    }
+
+    void add(const SceneRecord &r) { append(SCENE_OP_ADD, r); }
+
+    void remove(uint32_t id)
+    {
+        SceneRecord r = {};
+        r.id = id;
+        append(SCENE_OP_DELETE, r);
+    }
+
+    void recolor(uint32_t id, uint32_t color)
+    {
+        SceneRecord r = {};
+        r.id = id;
+        r.color = color;
+        append(SCENE_OP_RECOLOR, r);
+    }
+
+    // Fim do quadro: o buffer vai para o sistema (sem fsync)
+    void flush()
+    {
+        if (file)
+            std::fflush(file);
+    }
+
+    bool wantsSnapshot() const { return file && opsSinceSnapshot >= compactEvery && !writing; }
+
+    // A cena inteira neste momento; a gravação roda numa thread e o diário
+    // segue numa geração nova
+    void snapshot(std::vector<SceneRecord> records, uint32_t nextId)
+    {
+        waitSnapshot();
+        finishJournal();
+        uint64_t covered = generation++;
+        startJournal();
+        opsSinceSnapshot = 0;
+        std::string base = prefix;
+        std::vector<uint64_t> old = generations();
+        writing = true;
+        writer = std::thread([this, base, covered, nextId, old, records = std::move(records)] {
+            auto start = std::chrono::steady_clock::now();
+            if (sceneWriteSnapshot(base + ".snapshot", records.data(), records.size(), covered, nextId))
+            {
+                std::error_code ec;
+                for (uint64_t gen : old)
+                    if (gen <= covered)
+                        std::filesystem::remove(journalPath(gen), ec);
+                lastSnapshotMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            }
+            else
+            {
+                std::cerr << "SceneJournal: falha ao gravar " << base << ".snapshot" << std::endl;
+            }
+            writing = false;
+        });
+    }
+
+    void close()
+    {
+        waitSnapshot();
+        finishJournal();
+    }
+
+    // nextId gravado no snapshot carregado (0 sem snapshot)
+    uint32_t snapshotNextId() const { return storedNextId; }
+    size_t snapshotRecords() const { return loadedRecords; }
+    size_t replayedOps() const { return replayed; }
+    double openMs() const { return replayMs; }
+    double snapshotMs() const { return lastSnapshotMs; }
+
+private:
+    std::string journalPath(uint64_t gen) const { return prefix + ".journal." + std::to_string(gen); }
+
+    // Gerações de diário existentes, em ordem
+    std::vector<uint64_t> generations() const
+    {
+        std::vector<uint64_t> gens;
+        std::filesystem::path base(prefix);
+        std::filesystem::path dir = base.has_parent_path() ? base.parent_path() : std::filesystem::path(".");
+        std::string lead = base.filename().string() + ".journal.";
+        std::error_code ec;
+        for (const auto &e : std::filesystem::directory_iterator(dir, ec))
+        {
+            std::string name = e.path().filename().string();
+            if (name.compare(0, lead.size(), lead) != 0 || name.size() == lead.size())
+                continue;
+            std::string digits = name.substr(lead.size());
+            if (digits.find_first_not_of("0123456789") == std::string::npos)
+                gens.push_back(std::stoull(digits));
+        }
+        std::sort(gens.begin(), gens.end());
+        return gens;
+    }
+
+    template <class OnOp>
+    size_t replay(uint64_t gen, OnOp &onOp)
+    {
+        FILE *f = std::fopen(journalPath(gen).c_str(), "rb");
+        if (!f)
+            return 0;
+        SceneJournalHeader h;
+        size_t count = 0;
+        if (std::fread(&h, sizeof(h), 1, f) == 1 && std::memcmp(h.magic, "FCGJRNL1", 8) == 0 && h.generation == gen)
+        {
+            std::vector<SceneOp> chunk(4096);
+            size_t n;
+            bool torn = false;
+            while (!torn && (n = std::fread(chunk.data(), sizeof(SceneOp), chunk.size(), f)) > 0)
+            {
+                for (size_t i = 0; i < n; ++i)
+                {
+                    if (chunk[i].check != sceneOpChecksum(chunk[i]))
+                    {
+                        torn = true;
+                        break;
+                    }
+                    onOp(chunk[i]);
+                    ++count;
+                }
+            }
+            long end = std::ftell(f);
+            if (!torn && end != static_cast<long>(sizeof(h) + count * sizeof(SceneOp)))
+                torn = true; // registro final incompleto
+            if (torn)
+                std::cerr << "SceneJournal: diario " << gen << " cortado depois de " << count << " registros" << std::endl;
+        }
+        std::fclose(f);
+        return count;
+    }
+
+    bool startJournal()
+    {
+        file = std::fopen(journalPath(generation).c_str(), "wb");
+        if (!file)
+        {
+            std::cerr << "SceneJournal: nao consegui criar " << journalPath(generation) << std::endl;
+            return false;
+        }
+        std::setvbuf(file, nullptr, _IOFBF, 1 << 20);
+        SceneJournalHeader h = {};
+        std::memcpy(h.magic, "FCGJRNL1", 8);
+        h.generation = generation;
+        std::fwrite(&h, sizeof(h), 1, file);
+        return true;
+    }
+
+    void finishJournal()
+    {
+        if (!file)
+            return;
+        std::fclose(file);
+        file = nullptr;
+    }
+
+    void waitSnapshot()
+    {
+        if (writer.joinable())
+            writer.join();
+    }
+
+    void append(uint32_t type, const SceneRecord &r)
+    {
+        if (!file)
+            return;
+        SceneOp op;
+        op.type = type;
+        op.record = r;
+        op.check = sceneOpChecksum(op);
+        std::fwrite(&op, sizeof(op), 1, file);
+        ++opsSinceSnapshot;
+    }
+
+    std::string prefix;
+    FILE *file = nullptr;
+    uint64_t generation = 1;
+    size_t opsSinceSnapshot = 0, replayed = 0, loadedRecords = 0;
+    uint32_t storedNextId = 0;
+    double replayMs = 0.0;
+    std::atomic<double> lastSnapshotMs{0.0};
+    std::atomic<bool> writing{false};
+    std::thread writer;
+};
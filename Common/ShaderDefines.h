@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstring>
+#include <string>
+
+#include <glad/glad.h>
+
+// Texto GLSL com "#define <define>" logo depois da linha #version (que tem de
+// ser a primeira diretiva), para ligar variantes #ifdef de um mesmo shader.
+// Sem define, devolve o texto como está.
+inline std::string glslWithDefine(const GLchar *src, const char *define)
+{
+    std::string text(src);
+    if (!define || !*define)
+        return text;
+    size_t version = text.find("#version");
+    size_t lineEnd = version == std::string::npos ? std::string::npos : text.find('\n', version);
+    std::string line = std::string("#define ") + define + "\n";
+    if (lineEnd == std::string::npos)
+        return line + text;
+    return text.insert(lineEnd + 1, line);
+}
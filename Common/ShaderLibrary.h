@@ -0,0 +1,454 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include "ShaderProgram.h"
+
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
+// Programas de shader lidos de arquivos, compilados sem travar o laço e
+// recarregados quando o arquivo muda.
+//
+//   ShaderLibrary shaders;
+//   shaders.init(window);
+//   auto h = shaders.load("assets/shaders/a.vert", "assets/shaders/a.frag", vsSrc, fsSrc);
+//   ...outras cargas (compilam em paralelo), setupGeometry()...
+//   shaders.waitAll();                         // antes do primeiro quadro
+//   while (...) { shaders.update(); glUseProgram(shaders.program(h)); ... }
+//
+// Modos (FCG_SHADER_COMPILE força um deles):
+//   khr     GL_KHR/ARB_parallel_shader_compile: compila e linka na thread
+//           principal e o driver trabalha em paralelo; update() só consulta
+//           GL_COMPLETION_STATUS_KHR, que não bloqueia.
+//   thread  sem a extensão: uma thread com um contexto auxiliar (janela
+//           invisível que compartilha objetos com a principal) compila e linka.
+//   sync    tudo na thread principal, como os exercícios faziam (comparação).
+//
+// A troca é atômica do ponto de vista do laço: program(h) devolve o programa
+// antigo até o novo estar linkado. Se o novo falhar, o log vai para std::cerr
+// e o antigo continua. Como uniforms são do programa, version(h) muda a cada
+// troca para o exercício reenviar os que não manda todo quadro.
+//
+// O texto embutido (fallbackVs/Fs) é usado quando o arquivo não existe (o
+// executável rodando fora da raiz do projeto) ou a primeira versão do arquivo
+// não compila.
+class ShaderLibrary
+{
+public:
+    typedef size_t Handle;
+    enum class Mode { Khr, Thread, Sync };
+
+    ~ShaderLibrary() { stopWorker(); }
+
+    // window: janela do contexto principal (atual nesta thread)
+    void init(GLFWwindow *window)
+    {
+        mainWindow = window;
+        const char *forced = std::getenv("FCG_SHADER_COMPILE");
+        std::string want = forced ? forced : "";
+        bool khr = hasParallelCompile();
+        if (want == "sync")
+            currentMode = Mode::Sync;
+        else if (want == "thread" || !khr)
+            currentMode = Mode::Thread;
+        else
+            currentMode = Mode::Khr;
+
+        if (currentMode == Mode::Khr)
+        {
+            typedef void(APIENTRYP MaxThreadsFn)(GLuint);
+            MaxThreadsFn maxThreads = (MaxThreadsFn)glfwGetProcAddress("glMaxShaderCompilerThreadsKHR");
+            if (!maxThreads)
+                maxThreads = (MaxThreadsFn)glfwGetProcAddress("glMaxShaderCompilerThreadsARB");
+            if (maxThreads)
+                maxThreads(0xFFFFFFFFu); // quantas threads o driver quiser
+        }
+        else if (currentMode == Mode::Thread)
+        {
+            startWorker();
+        }
+    }
+
+    Mode mode() const { return currentMode; }
+    const char *modeName() const
+    {
+        return currentMode == Mode::Khr ? "khr" : currentMode == Mode::Thread ? "thread" : "sync";
+    }
+
+    Handle load(const std::string &vertexPath, const std::string &fragmentPath, const GLchar *fallbackVs = nullptr,
+                const GLchar *fallbackFs = nullptr)
+    {
+        Entry e;
+        e.paths[0] = vertexPath;
+        e.paths[1] = fragmentPath;
+        e.fallback[0] = fallbackVs ? fallbackVs : "";
+        e.fallback[1] = fallbackFs ? fallbackFs : "";
+        entries.push_back(e);
+        Handle h = entries.size() - 1;
+        rebuild(h);
+        return h;
+    }
+
+    // 0 até a primeira versão ficar pronta
+    GLuint program(Handle h) const { return entries[h].program; }
+    uint64_t version(Handle h) const { return entries[h].version; }
+
+    // Uma vez por quadro: troca os programas prontos e, a cada watchInterval
+    // segundos, confere a data dos arquivos
+    void update()
+    {
+        collect(false);
+        auto now = std::chrono::steady_clock::now();
+        if (now < nextWatch)
+            return;
+        nextWatch = now + std::chrono::milliseconds(static_cast<int>(watchInterval * 1000.0));
+        for (Handle h = 0; h < entries.size(); ++h)
+        {
+            Entry &e = entries[h];
+            if (stamp(e.paths[0]) != e.stamps[0] || stamp(e.paths[1]) != e.stamps[1])
+            {
+                std::cout << "ShaderLibrary: recarregando " << e.paths[0] << " + " << e.paths[1] << std::endl;
+                rebuild(h);
+            }
+        }
+    }
+
+    // Bloqueia até todos os programas pedidos terem terminado (bem ou mal),
+    // inclusive o texto embutido pedido quando o arquivo não compila
+    void waitAll() { collect(true); }
+
+    double watchInterval = 0.5;
+
+    void release()
+    {
+        stopWorker();
+        for (Entry &e : entries)
+        {
+            glDeleteProgram(e.program);
+            discardPending(e);
+        }
+        entries.clear();
+        if (helperWindow)
+            glfwDestroyWindow(helperWindow);
+        helperWindow = nullptr;
+    }
+
+private:
+    typedef std::filesystem::file_time_type Stamp;
+
+    struct Entry
+    {
+        std::string paths[2], fallback[2];
+        Stamp stamps[2];
+        GLuint program = 0;
+        uint64_t version = 0;
+        bool fromFile = false;
+        // Em compilação (modo khr)
+        GLuint pendingProgram = 0, pendingShaders[2] = {0, 0};
+        bool pendingFromFile = false;
+        int inFlight = 0; // pedidos ainda sem resposta (khr e thread)
+    };
+
+    struct Job
+    {
+        Handle handle;
+        std::string sources[2];
+        bool fromFile;
+    };
+
+    struct Result
+    {
+        Handle handle;
+        GLuint program;
+        bool fromFile;
+        std::string log;
+    };
+
+    static Stamp stamp(const std::string &path)
+    {
+        std::error_code ec;
+        Stamp t = std::filesystem::last_write_time(path, ec);
+        return ec ? Stamp::min() : t;
+    }
+
+    static bool readFile(const std::string &path, std::string &out)
+    {
+        std::ifstream in(path, std::ios::binary);
+        if (!in)
+            return false;
+        std::ostringstream ss;
+        ss << in.rdbuf();
+        out = ss.str();
+        return true;
+    }
+
+    bool hasParallelCompile() const
+    {
+        GLint count = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+        for (GLint i = 0; i < count; ++i)
+        {
+            const char *ext = reinterpret_cast<const char *>(glGetStringi(GL_EXTENSIONS, i));
+            if (ext && (std::strcmp(ext, "GL_KHR_parallel_shader_compile") == 0 ||
+                        std::strcmp(ext, "GL_ARB_parallel_shader_compile") == 0))
+                return true;
+        }
+        return false;
+    }
+
+    // Lê os arquivos e dispara a compilação; sem arquivo, usa o texto embutido
+    void rebuild(Handle h)
+    {
+        Entry &e = entries[h];
+        Job job{h, {}, true};
+        for (int i = 0; i < 2; ++i)
+        {
+            e.stamps[i] = stamp(e.paths[i]);
+            if (!readFile(e.paths[i], job.sources[i]))
+                job.fromFile = false;
+        }
+        if (!job.fromFile)
+        {
+            if (e.fallback[0].empty() || e.fallback[1].empty())
+            {
+                std::cerr << "ShaderLibrary: nao encontrei " << e.paths[0] << " / " << e.paths[1] << std::endl;
+                return;
+            }
+            if (e.program && !e.fromFile)
+                return; // já está no embutido
+            job.sources[0] = e.fallback[0];
+            job.sources[1] = e.fallback[1];
+        }
+        submit(std::move(job));
+    }
+
+    void submit(Job job)
+    {
+        Entry &e = entries[job.handle];
+        if (currentMode == Mode::Thread)
+        {
+            ++e.inFlight;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                jobs.push_back(std::move(job));
+            }
+            cv.notify_one();
+            return;
+        }
+        if (currentMode == Mode::Khr)
+        {
+            discardPending(e); // uma versão mais nova substitui a que ainda compilava
+            e.pendingShaders[0] = compileShader(GL_VERTEX_SHADER, job.sources[0].c_str());
+            e.pendingShaders[1] = compileShader(GL_FRAGMENT_SHADER, job.sources[1].c_str());
+            e.pendingProgram = glCreateProgram();
+            glAttachShader(e.pendingProgram, e.pendingShaders[0]);
+            glAttachShader(e.pendingProgram, e.pendingShaders[1]);
+            glLinkProgram(e.pendingProgram);
+            e.pendingFromFile = job.fromFile;
+            e.inFlight = 1;
+            return;
+        }
+        std::string log;
+        GLuint prog = buildBlocking(job.sources, log);
+        finish({job.handle, prog, job.fromFile, log});
+    }
+
+    void discardPending(Entry &e)
+    {
+        if (!e.pendingProgram)
+            return;
+        glDeleteProgram(e.pendingProgram);
+        glDeleteShader(e.pendingShaders[0]);
+        glDeleteShader(e.pendingShaders[1]);
+        e.pendingProgram = e.pendingShaders[0] = e.pendingShaders[1] = 0;
+        e.inFlight = 0;
+    }
+
+    // Recolhe o que ficou pronto; com wait, espera todos os pedidos, inclusive
+    // o texto embutido que finish() pede quando o arquivo não compila
+    void collect(bool wait)
+    {
+        collectReady(wait);
+        while (wait && anyInFlight())
+            collectReady(true);
+    }
+
+    bool anyInFlight() const
+    {
+        for (const Entry &e : entries)
+            if (e.inFlight > 0)
+                return true;
+        return false;
+    }
+
+    void collectReady(bool wait)
+    {
+        if (currentMode == Mode::Khr)
+        {
+            for (Handle h = 0; h < entries.size(); ++h)
+            {
+                Entry &e = entries[h];
+                if (!e.pendingProgram)
+                    continue;
+                GLint done = GL_TRUE;
+                if (!wait)
+                    glGetProgramiv(e.pendingProgram, GL_COMPLETION_STATUS_KHR, &done);
+                if (!done)
+                    continue;
+                std::string log = programLog(e.pendingProgram, e.pendingShaders, 2);
+                GLuint prog = log.empty() ? e.pendingProgram : 0;
+                if (!prog)
+                    glDeleteProgram(e.pendingProgram);
+                glDeleteShader(e.pendingShaders[0]);
+                glDeleteShader(e.pendingShaders[1]);
+                bool fromFile = e.pendingFromFile;
+                e.pendingProgram = e.pendingShaders[0] = e.pendingShaders[1] = 0;
+                e.inFlight = 0;
+                finish({h, prog, fromFile, log});
+            }
+        }
+        else if (currentMode == Mode::Thread)
+        {
+            std::deque<Result> ready;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                if (wait)
+                    doneCv.wait(lock, [this] { return jobs.empty() && busy == 0; });
+                ready.swap(results);
+            }
+            for (Result &r : ready)
+            {
+                --entries[r.handle].inFlight;
+                finish(r);
+            }
+        }
+    }
+
+    // Troca (sucesso) ou mantém o antigo (falha)
+    void finish(const Result &r)
+    {
+        Entry &e = entries[r.handle];
+        if (!r.program)
+        {
+            std::cerr << "ShaderLibrary: " << e.paths[0] << " + " << e.paths[1] << " nao compilou"
+                      << (e.program ? ", mantendo a versao anterior" : "") << "\n" << r.log << std::endl;
+            // Primeira versão do arquivo quebrada: usa o texto embutido
+            if (!e.program && r.fromFile && !e.fallback[0].empty() && !e.fallback[1].empty())
+                submit({r.handle, {e.fallback[0], e.fallback[1]}, false});
+            return;
+        }
+        glDeleteProgram(e.program);
+        e.program = r.program;
+        e.fromFile = r.fromFile;
+        ++e.version;
+    }
+
+    static GLuint buildBlocking(const std::string *sources, std::string &log)
+    {
+        GLuint shaders[2] = {compileShader(GL_VERTEX_SHADER, sources[0].c_str()),
+                             compileShader(GL_FRAGMENT_SHADER, sources[1].c_str())};
+        GLuint prog = glCreateProgram();
+        glAttachShader(prog, shaders[0]);
+        glAttachShader(prog, shaders[1]);
+        glLinkProgram(prog);
+        log = programLog(prog, shaders, 2);
+        glDeleteShader(shaders[0]);
+        glDeleteShader(shaders[1]);
+        if (!log.empty())
+        {
+            glDeleteProgram(prog);
+            return 0;
+        }
+        return prog;
+    }
+
+    // A janela auxiliar precisa ser criada na thread principal (regra da GLFW).
+    // A dica de visibilidade volta ao valor com que a janela principal foi
+    // criada, para não esconder janelas que o programa crie depois.
+    void startWorker()
+    {
+        int visible = glfwGetWindowAttrib(mainWindow, GLFW_VISIBLE);
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+        helperWindow = glfwCreateWindow(1, 1, "shaders", nullptr, mainWindow);
+        glfwWindowHint(GLFW_VISIBLE, visible ? GLFW_TRUE : GLFW_FALSE);
+        glfwMakeContextCurrent(mainWindow);
+        if (!helperWindow)
+        {
+            std::cerr << "ShaderLibrary: sem contexto auxiliar, compilando na thread principal" << std::endl;
+            currentMode = Mode::Sync;
+            return;
+        }
+        worker = std::thread([this] { run(); });
+    }
+
+    void stopWorker()
+    {
+        if (!worker.joinable())
+            return;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        cv.notify_all();
+        worker.join();
+    }
+
+    void run()
+    {
+        glfwMakeContextCurrent(helperWindow);
+        for (;;)
+        {
+            Job job;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                cv.wait(lock, [this] { return stopping || !jobs.empty(); });
+                if (stopping)
+                    break;
+                job = std::move(jobs.front());
+                jobs.pop_front();
+                ++busy;
+            }
+            std::string log;
+            GLuint prog = buildBlocking(job.sources, log);
+            glFinish(); // o link precisa estar completo antes de o contexto principal usar o programa
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                results.push_back({job.handle, prog, job.fromFile, log});
+                --busy;
+            }
+            doneCv.notify_all();
+        }
+        glfwMakeContextCurrent(nullptr);
+    }
+
+    Mode currentMode = Mode::Sync;
+    GLFWwindow *mainWindow = nullptr, *helperWindow = nullptr;
+    std::vector<Entry> entries;
+    std::chrono::steady_clock::time_point nextWatch;
+
+    std::thread worker;
+    std::mutex mutex;
+    std::condition_variable cv, doneCv;
+    std::deque<Job> jobs;
+    std::deque<Result> results;
+    int busy = 0;
+    bool stopping = false;
+};
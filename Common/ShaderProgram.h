@@ -0,0 +1,96 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+
+#include <glad/glad.h>
+
+// Compilação e link de programas GLSL, compartilhados pelos helpers de Common.
+//
+// linkProgram(vs, fs, "Canvas") compila os dois estágios, linka e devolve 0 se
+// algo falhar, com os logs no stderr precedidos pela etiqueta. Para outros
+// estágios (geometria, tesselação) ou para mexer no programa antes do link
+// (varyings de transform feedback), compileShader() + linkStages().
+//
+// O status de compilação só é lido depois do link: um estágio que não compilou
+// faz o link falhar, e quem linka sem esperar (ShaderLibrary no modo khr) não
+// trava no glGetShaderiv logo depois do glCompileShader.
+
+// Compila um estágio; prefix (opcional) vai antes do texto, como outra string
+inline GLuint compileShader(GLenum type, const GLchar *src, const GLchar *prefix = nullptr)
+{
+    GLuint shader = glCreateShader(type);
+    const GLchar *parts[] = {prefix, src};
+    if (prefix)
+        glShaderSource(shader, 2, parts, NULL);
+    else
+        glShaderSource(shader, 1, &src, NULL);
+    glCompileShader(shader);
+    return shader;
+}
+
+inline const char *shaderStageName(GLuint shader)
+{
+    GLint type = 0;
+    glGetShaderiv(shader, GL_SHADER_TYPE, &type);
+    switch (type)
+    {
+    case GL_VERTEX_SHADER: return "VS";
+    case GL_TESS_CONTROL_SHADER: return "TCS";
+    case GL_TESS_EVALUATION_SHADER: return "TES";
+    case GL_GEOMETRY_SHADER: return "GS";
+    case GL_FRAGMENT_SHADER: return "FS";
+    default: return "?";
+    }
+}
+
+// Vazio se o programa linkou; senão os logs dos estágios que não compilaram e o do link
+inline std::string programLog(GLuint prog, const GLuint *stages, int count)
+{
+    GLint ok;
+    glGetProgramiv(prog, GL_LINK_STATUS, &ok);
+    if (ok)
+        return std::string();
+    std::string out;
+    GLchar log[512];
+    for (int i = 0; i < count; ++i)
+    {
+        glGetShaderiv(stages[i], GL_COMPILE_STATUS, &ok);
+        if (!ok)
+        {
+            glGetShaderInfoLog(stages[i], 512, NULL, log);
+            out += shaderStageName(stages[i]) + std::string(":\n") + log;
+        }
+    }
+    glGetProgramInfoLog(prog, 512, NULL, log);
+    out += "LINK:\n" + std::string(log);
+    return out;
+}
+
+// Linka os estágios já compilados e os apaga. beforeLink (opcional) recebe o
+// programa antes do glLinkProgram. Devolve 0 se falhar, com o log no stderr.
+inline GLuint linkStages(const GLuint *stages, int count, const char *tag, void (*beforeLink)(GLuint) = nullptr)
+{
+    GLuint prog = glCreateProgram();
+    for (int i = 0; i < count; ++i)
+        glAttachShader(prog, stages[i]);
+    if (beforeLink)
+        beforeLink(prog);
+    glLinkProgram(prog);
+    std::string log = programLog(prog, stages, count);
+    for (int i = 0; i < count; ++i)
+        glDeleteShader(stages[i]);
+    if (!log.empty())
+    {
+        std::cerr << tag << " " << log << std::endl;
+        glDeleteProgram(prog);
+        return 0;
+    }
+    return prog;
+}
+
+inline GLuint linkProgram(const GLchar *vsText, const GLchar *fsText, const char *tag)
+{
+    GLuint stages[] = {compileShader(GL_VERTEX_SHADER, vsText), compileShader(GL_FRAGMENT_SHADER, fsText)};
+    return linkStages(stages, 2, tag);
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <string>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+// dlopen/LoadLibrary com a mesma cara nos dois sistemas
+class SharedLibrary
+{
+public:
+    SharedLibrary() {}
+    SharedLibrary(const SharedLibrary &) = delete;
+    SharedLibrary &operator=(const SharedLibrary &) = delete;
+    ~SharedLibrary() { close(); }
+
+    bool open(const std::string &path)
+    {
+        close();
+#ifdef _WIN32
+        handle = LoadLibraryA(path.c_str());
+        lastError = handle ? "" : "LoadLibrary falhou (" + std::to_string(GetLastError()) + ")";
+#else
+        handle = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+        lastError = handle ? "" : dlerror();
+#endif
+        return handle != nullptr;
+    }
+
+    template <class Fn>
+    Fn symbol(const char *name) const
+    {
+        if (!handle)
+            return nullptr;
+#ifdef _WIN32
+        return reinterpret_cast<Fn>(GetProcAddress(static_cast<HMODULE>(handle), name));
+#else
+        return reinterpret_cast<Fn>(dlsym(handle, name));
+#endif
+    }
+
+    void close()
+    {
+        if (!handle)
+            return;
+#ifdef _WIN32
+        FreeLibrary(static_cast<HMODULE>(handle));
+#else
+        dlclose(handle);
+#endif
+        handle = nullptr;
+    }
+
+    bool isOpen() const { return handle != nullptr; }
+    const std::string &error() const { return lastError; }
+
+private:
+    void *handle = nullptr;
+    std::string lastError;
+};
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstdio>
+#include <cstdlib>
+#include <type_traits>
+#include <vector>
+
+#include "ChromeTrace.h"
+
+// Perfil da inicialização: mede cada fase até o primeiro quadro (glfwInit,
+// glfwCreateWindow, carregador GL, setupShader, setupGeometry e o primeiro
+// glfwSwapBuffers). O custo fora do modo ligado é só duas leituras de relógio
+// por fase, que acontecem uma única vez.
+//
+// Com FCG_STARTUP_TRACE=arquivo.json, ao fim do primeiro quadro as fases são
+// gravadas no formato do Chrome (chrome://tracing ou ui.perfetto.dev) e um
+// resumo é impresso no terminal.
+//
+// Uso:
+//   PROFILE_PHASE("glfwInit", glfwInit());
+//   GLFWwindow *window = PROFILE_PHASE("glfwCreateWindow", glfwCreateWindow(...));
+//   ...
+//   PROFILE_FIRST_FRAME(glfwSwapBuffers(window));   // no loop
+
+inline std::vector<TraceEvent> &startupEvents()
+{
+    static std::vector<TraceEvent> events;
+    return events;
+}
+
+inline void startupRecord(const char *name, double startUs)
+{
+    startupEvents().push_back({name, "startup", startUs, traceNowUs() - startUs, 0});
+}
+
+template <class F>
+auto profilePhase(const char *name, F &&fn) -> decltype(fn())
+{
+    double start = traceNowUs();
+    if constexpr (std::is_void<decltype(fn())>::value)
+    {
+        fn();
+        startupRecord(name, start);
+    }
+    else
+    {
+        auto result = fn();
+        startupRecord(name, start);
+        return result;
+    }
+}
+
+inline void startupFlush()
+{
+    const char *path = std::getenv("FCG_STARTUP_TRACE");
+    if (!path || !*path)
+        return;
+
+    std::vector<TraceEvent> events = startupEvents();
+    double total = traceNowUs();
+    events.insert(events.begin(), {"ate o primeiro quadro", "startup", 0.0, total, 0});
+    if (!writeChromeTrace(path, events))
+    {
+        std::fprintf(stderr, "Falha ao gravar %s\n", path);
+        return;
+    }
+
+    std::printf("Inicializacao (%s):\n", path);
+    for (const TraceEvent &e : events)
+        std::printf("  %-32s %9.3f ms\n", e.name, e.durationUs / 1000.0);
+}
+
+// Mede só a primeira chamada (o primeiro quadro) e grava o perfil
+template <class F>
+void profileFirstFrame(F &&fn)
+{
+    static bool done = false;
+    if (done)
+    {
+        fn();
+        return;
+    }
+    done = true;
+    profilePhase("primeiro glfwSwapBuffers", fn);
+    startupFlush();
+}
+
+#define PROFILE_PHASE(name, expr) profilePhase(name, [&]() { return (expr); })
+#define PROFILE_FIRST_FRAME(expr) profileFirstFrame([&]() { expr; })
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <cstdlib>
+#include <iostream>
+
+#include <glad/glad.h>
+
+#include "ShaderProgram.h"
+
+// Camada estática: o que não muda entre quadros é desenhado uma vez numa
+// textura (FBO do tamanho da janela) e cada quadro seguinte só copia essa
+// textura para a tela. Uma cena parada custa um glBlitFramebuffer em vez de
+// limpar e refazer todos os draws; o que muda (HUD, cursor...) vai por cima.
+//
+// A cópia tem custo fixo de uma tela inteira, então só compensa quando o
+// desenho da cena custa mais que ela. Por isso fica desligada por padrão
+// (FCG_LAYERS=1 liga): nas cenas de poucas centenas de triângulos das listas
+// a cópia medida foi mais cara que redesenhar.
+//
+//   StaticLayer layer;                        // FCG_LAYERS=1 liga a camada
+//   if (layer.begin(w, h)) {                  // só quando suja ou a janela mudou
+//       aa.beginFrame(w, h);  glClear(...);  ...draws...;
+//       aa.endFrame(layer.framebuffer());     // o MSAA resolve na camada
+//       layer.end();
+//   }
+//   layer.draw();                             // cópia para o framebuffer ligado
+//   ...overlay dinâmico...
+//
+// markDirty() pede um novo desenho (uma textura que terminou de carregar, um
+// parâmetro que mudou). Uma camada opaca (padrão) cobre a tela inteira e vai
+// por glBlitFramebuffer; com opaque = false ela é composta por cima do que já
+// está na tela, num triângulo de tela cheia com alpha pré-multiplicado, e
+// pode ser empilhada sobre outras camadas.
+inline bool layersFromEnv()
+{
+    const char *v = std::getenv("FCG_LAYERS");
+    return v && v[0] == '1';
+}
+
+class StaticLayer
+{
+public:
+    bool opaque = true;
+
+    explicit StaticLayer(bool on = layersFromEnv()) : enabled(on) {}
+
+    bool cached() const { return enabled; }
+
+    // true se a camada precisa ser desenhada agora; nesse caso o FBO dela fica
+    // ligado até end(). Desligada, sempre true e o desenho vai direto para a tela.
+    bool begin(int w, int h)
+    {
+        if (!enabled)
+            return true;
+        if (fbo && !dirty && w == width && h == height)
+            return false;
+        glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &target);
+        if (!ensureTarget(w, h))
+            return true;
+        glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+        return true;
+    }
+
+    // Framebuffer em que o desenho da camada termina (0 desligada: a janela)
+    GLuint framebuffer() const { return enabled ? fbo : 0; }
+
+    void end()
+    {
+        if (!enabled)
+            return;
+        glBindFramebuffer(GL_FRAMEBUFFER, target);
+        dirty = false;
+        ++renders;
+    }
+
+    // Compõe a camada no framebuffer ligado
+    void draw()
+    {
+        if (!enabled || !fbo)
+            return;
+        GLint drawTarget;
+        glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &drawTarget);
+        if (opaque)
+        {
+            glBindFramebuffer(GL_READ_FRAMEBUFFER, fbo);
+            glBlitFramebuffer(0, 0, width, height, 0, 0, width, height, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+            glBindFramebuffer(GL_READ_FRAMEBUFFER, drawTarget);
+            return;
+        }
+        if (!compositeProgram)
+        {
+            compositeProgram = linkProgram(compositeVertexSrc, compositeFragmentSrc, "StaticLayer");
+            glGenVertexArrays(1, &emptyVao);
+        }
+        // Devolve programa e estado de blend como estavam: quem desenha por
+        // cima da camada continua com a sua própria função de blend
+        GLint previous, srcRgb, dstRgb, srcAlpha, dstAlpha;
+        glGetIntegerv(GL_CURRENT_PROGRAM, &previous);
+        glGetIntegerv(GL_BLEND_SRC_RGB, &srcRgb);
+        glGetIntegerv(GL_BLEND_DST_RGB, &dstRgb);
+        glGetIntegerv(GL_BLEND_SRC_ALPHA, &srcAlpha);
+        glGetIntegerv(GL_BLEND_DST_ALPHA, &dstAlpha);
+        GLboolean blend = glIsEnabled(GL_BLEND);
+        glEnable(GL_BLEND);
+        glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+        glUseProgram(compositeProgram);
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glBindVertexArray(emptyVao);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+        glBindVertexArray(0);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        glUseProgram(previous);
+        glBlendFuncSeparate(srcRgb, dstRgb, srcAlpha, dstAlpha);
+        if (!blend)
+            glDisable(GL_BLEND);
+    }
+
+    void markDirty() { dirty = true; }
+    bool isDirty() const { return dirty; }
+    size_t renderCount() const { return renders; } // quantas vezes a camada foi desenhada
+
+    void release()
+    {
+        glDeleteFramebuffers(1, &fbo);
+        glDeleteTextures(1, &texture);
+        glDeleteProgram(compositeProgram);
+        glDeleteVertexArrays(1, &emptyVao);
+        fbo = texture = compositeProgram = emptyVao = 0;
+        dirty = true;
+    }
+
+private:
+    // Cria ou redimensiona a textura
+    bool ensureTarget(int w, int h)
+    {
+        if (!fbo)
+        {
+            glGenFramebuffers(1, &fbo);
+            glGenTextures(1, &texture);
+        }
+        if (w != width || h != height)
+        {
+            width = w;
+            height = h;
+            glBindTexture(GL_TEXTURE_2D, texture);
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, w, h, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+            glBindTexture(GL_TEXTURE_2D, 0);
+            glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+            glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+            GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+            glBindFramebuffer(GL_FRAMEBUFFER, target);
+            if (status != GL_FRAMEBUFFER_COMPLETE)
+            {
+                std::cerr << "StaticLayer: FBO incompleto, desenhando direto na tela" << std::endl;
+                release();
+                enabled = false;
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Triângulo que cobre a tela, sem VBO; a textura tem o tamanho da tela
+    static constexpr const GLchar *compositeVertexSrc = R"(
+ #version 400
+ void main()
+ {
+	 vec2 p = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+	 gl_Position = vec4(p * 2.0 - 1.0, 0.0, 1.0);
+ }
+ )";
+
+    // A camada transparente é limpa com alpha 0 e desenhada em alpha
+    // pré-multiplicado (por exemplo glBlendFuncSeparate(GL_SRC_ALPHA,
+    // GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA))
+    static constexpr const GLchar *compositeFragmentSrc = R"(
+ #version 400
+ uniform sampler2D layer;
+ out vec4 color;
+ void main()
+ {
+	 color = texelFetch(layer, ivec2(gl_FragCoord.xy), 0);
+ }
+ )";
+
+    bool enabled;
+    bool dirty = true;
+    GLuint fbo = 0, texture = 0, compositeProgram = 0, emptyVao = 0;
+    GLint target = 0;
+    int width = 0, height = 0;
+    size_t renders = 0;
+};
@@ -0,0 +1,7 @@
+#pragma once
+
+// Cada exercício é um único arquivo .cpp, então a implementação da stb_image
+// pode ser gerada aqui mesmo. O #pragma once garante que ela entre uma vez só,
+// mesmo que vários módulos da pasta Common incluam este cabeçalho.
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
@@ -0,0 +1,5 @@
+#pragma once
+
+// Mesma ideia do StbImage.h: implementação gerada uma única vez por programa
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <stb_image_write.h>
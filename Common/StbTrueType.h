@@ -0,0 +1,6 @@
+#pragma once
+
+// Mesmo esquema do StbImage.h: a implementação da stb_truetype entra uma vez
+// só no único .cpp do exercício.
+#define STB_TRUETYPE_IMPLEMENTATION
+#include <stb_truetype.h>
@@ -0,0 +1,243 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <glad/glad.h>
+
+#include "ShaderProgram.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// Arcos e espirais gerados inteiramente na GPU pelos estágios de tesselação
+// (GL 4.0). Cada arco é um patch de um vértice só com os parâmetros da curva;
+// o shader de controle escolhe o nível de tesselação pelo comprimento do arco
+// na tela, então a CPU envia os mesmos bytes seja qual for o zoom.
+//
+// Curva de um patch: theta = start + t*sweep, r = r0 + growth*t*sweep,
+// t em [0, 1]. growth = 0 dá um arco de círculo; growth = b dá a espiral
+// r = a + b*theta.
+struct TessArc
+{
+    float cx, cy, r0, growth;
+    float start, sweep;
+};
+
+// Arco de círculo em patches de no máximo 90 graus (o preenchimento tem até 64
+// segmentos por patch)
+inline void tessArc(std::vector<TessArc> &out, float cx, float cy, float radius, float start, float sweep)
+{
+    int pieces = std::max(1, static_cast<int>(std::ceil(std::fabs(sweep) / (M_PI / 2.0) - 1e-4)));
+    float step = sweep / pieces;
+    for (int i = 0; i < pieces; ++i)
+        out.push_back({cx, cy, radius, 0.0f, start + step * i, step});
+}
+
+// Espiral de Arquimedes r = a + b*theta de 0 a thetaEnd, um patch por volta
+inline void tessSpiral(std::vector<TessArc> &out, float cx, float cy, float a, float b, float thetaEnd)
+{
+    const float turn = 2.0f * M_PI;
+    for (float theta = 0.0f; theta < thetaEnd; theta += turn)
+        out.push_back({cx, cy, a + b * theta, b, theta, std::min(turn, thetaEnd - theta)});
+}
+
+class TessArcRenderer
+{
+public:
+    // Pixels de comprimento na tela por segmento gerado
+    float pixelsPerSegment = 4.0f;
+    // Matriz aplicada aos pontos gerados (coluna a coluna, como glUniformMatrix4fv)
+    float transform[16] = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1};
+
+    bool init()
+    {
+        strokeProgram = link(strokeControl, strokeEval);
+        fillProgram = link(fillControl, fillEval);
+        if (!strokeProgram || !fillProgram)
+            return false;
+
+        glGenVertexArrays(1, &vao);
+        glGenBuffers(1, &vbo);
+        glBindVertexArray(vao);
+        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, sizeof(TessArc), (GLvoid *)0);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(TessArc), (GLvoid *)(4 * sizeof(GLfloat)));
+        glEnableVertexAttribArray(1);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindVertexArray(0);
+        return true;
+    }
+
+    void upload(const std::vector<TessArc> &arcs)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        glBufferData(GL_ARRAY_BUFFER, arcs.size() * sizeof(TessArc), arcs.data(), GL_STATIC_DRAW);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        count = static_cast<GLsizei>(arcs.size());
+    }
+
+    // Contorno (segmentos de reta, largura de glLineWidth)
+    void drawStroke(int viewportW, int viewportH, float r, float g, float b, float a)
+    {
+        draw(strokeProgram, viewportW, viewportH, r, g, b, a);
+    }
+
+    // Setores preenchidos: do centro até a curva
+    void drawFill(int viewportW, int viewportH, float r, float g, float b, float a)
+    {
+        draw(fillProgram, viewportW, viewportH, r, g, b, a);
+    }
+
+    void release()
+    {
+        glDeleteProgram(strokeProgram);
+        glDeleteProgram(fillProgram);
+        glDeleteBuffers(1, &vbo);
+        glDeleteVertexArrays(1, &vao);
+        strokeProgram = fillProgram = vbo = vao = 0;
+    }
+
+private:
+    void draw(GLuint program, int viewportW, int viewportH, float r, float g, float b, float a)
+    {
+        if (!program || count == 0)
+            return;
+        glUseProgram(program);
+        glUniformMatrix4fv(glGetUniformLocation(program, "transform"), 1, GL_FALSE, transform);
+        glUniform2f(glGetUniformLocation(program, "viewport"), static_cast<float>(viewportW), static_cast<float>(viewportH));
+        glUniform1f(glGetUniformLocation(program, "pixelsPerSegment"), pixelsPerSegment);
+        glUniform4f(glGetUniformLocation(program, "inputColor"), r, g, b, a);
+        glPatchParameteri(GL_PATCH_VERTICES, 1);
+        glBindVertexArray(vao);
+        glDrawArrays(GL_PATCHES, 0, count);
+        glBindVertexArray(0);
+    }
+
+    // controlCommon vai antes de cada tessellation control shader (glShaderSource concatena)
+    static GLuint link(const GLchar *controlSrc, const GLchar *evalSrc)
+    {
+        GLuint stages[] = {compileShader(GL_VERTEX_SHADER, vertexSrc),
+                           compileShader(GL_TESS_CONTROL_SHADER, controlSrc, controlCommon),
+                           compileShader(GL_TESS_EVALUATION_SHADER, evalSrc), compileShader(GL_FRAGMENT_SHADER, fragmentSrc)};
+        return linkStages(stages, 4, "TessArcs");
+    }
+
+    static constexpr const GLchar *vertexSrc = R"(
+ #version 400
+ layout (location = 0) in vec4 arc;   // cx, cy, r0, crescimento
+ layout (location = 1) in vec2 range; // ângulo inicial, varredura
+ out vec4 vArc;
+ out vec2 vRange;
+ void main()
+ {
+	 vArc = arc;
+	 vRange = range;
+ }
+ )";
+
+    // Comprimento na tela (px) e descarte dos patches fora da tela; comum aos
+    // dois shaders de controle
+    static constexpr const GLchar *controlCommon = R"(
+ #version 400
+ layout (vertices = 1) out;
+ in vec4 vArc[];
+ in vec2 vRange[];
+ out vec4 tArc[];
+ out vec2 tRange[];
+ uniform mat4 transform;
+ uniform vec2 viewport;
+ uniform float pixelsPerSegment;
+ float screenSegments(out bool visible)
+ {
+	 float sweep = abs(vRange[0].y);
+	 float rMax = abs(vArc[0].z) + abs(vArc[0].w) * sweep;
+	 float scale = length(transform[0].xy);
+	 vec4 c = transform * vec4(vArc[0].xy, 0.0, 1.0);
+	 visible = all(lessThan(abs(c.xy) - rMax * scale, vec2(c.w)));
+	 float meanRadius = abs(vArc[0].z) + abs(vArc[0].w) * sweep * 0.5;
+	 float pixels = sweep * meanRadius * scale * 0.5 * max(viewport.x, viewport.y);
+	 return max(pixels / pixelsPerSegment, 1.0);
+ }
+ )";
+
+    // Isolinhas: até 64 linhas de até 64 segmentos, emendadas na avaliação
+    static constexpr const GLchar *strokeControl = R"(
+ void main()
+ {
+	 tArc[gl_InvocationID] = vArc[gl_InvocationID];
+	 tRange[gl_InvocationID] = vRange[gl_InvocationID];
+	 bool visible;
+	 float segments = min(screenSegments(visible), 4096.0);
+	 float lines = ceil(segments / 64.0);
+	 gl_TessLevelOuter[0] = visible ? lines : 0.0;
+	 gl_TessLevelOuter[1] = ceil(segments / lines);
+ }
+ )";
+
+    static constexpr const GLchar *strokeEval = R"(
+ #version 400
+ layout (isolines, equal_spacing) in;
+ in vec4 tArc[];
+ in vec2 tRange[];
+ uniform mat4 transform;
+ void main()
+ {
+	 // Linha j cobre [j, j+1]/linhas do arco
+	 float lines = gl_TessLevelOuter[0];
+	 float s = (floor(gl_TessCoord.y * lines + 0.5) + gl_TessCoord.x) / lines;
+	 float t = s * tRange[0].y;
+	 float r = tArc[0].z + tArc[0].w * t;
+	 float a = tRange[0].x + t;
+	 gl_Position = transform * vec4(tArc[0].xy + r * vec2(cos(a), sin(a)), 0.0, 1.0);
+ }
+ )";
+
+    // Quads: u ao longo do arco, v do centro até a curva
+    static constexpr const GLchar *fillControl = R"(
+ void main()
+ {
+	 tArc[gl_InvocationID] = vArc[gl_InvocationID];
+	 tRange[gl_InvocationID] = vRange[gl_InvocationID];
+	 bool visible;
+	 float segments = min(screenSegments(visible), 64.0);
+	 gl_TessLevelOuter[0] = visible ? 1.0 : 0.0;
+	 gl_TessLevelOuter[1] = segments;
+	 gl_TessLevelOuter[2] = 1.0;
+	 gl_TessLevelOuter[3] = segments;
+	 gl_TessLevelInner[0] = segments;
+	 gl_TessLevelInner[1] = 1.0;
+ }
+ )";
+
+    static constexpr const GLchar *fillEval = R"(
+ #version 400
+ layout (quads, equal_spacing, ccw) in;
+ in vec4 tArc[];
+ in vec2 tRange[];
+ uniform mat4 transform;
+ void main()
+ {
+	 float t = gl_TessCoord.x * tRange[0].y;
+	 float r = (tArc[0].z + tArc[0].w * t) * gl_TessCoord.y;
+	 float a = tRange[0].x + t;
+	 gl_Position = transform * vec4(tArc[0].xy + r * vec2(cos(a), sin(a)), 0.0, 1.0);
+ }
+ )";
+
+    static constexpr const GLchar *fragmentSrc = R"(
+ #version 400
+ uniform vec4 inputColor;
+ out vec4 color;
+ void main()
+ {
+	 color = inputColor;
+ }
+ )";
+
+    GLuint strokeProgram = 0, fillProgram = 0, vao = 0, vbo = 0;
+    GLsizei count = 0;
+};
@@ -0,0 +1,379 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <glad/glad.h>
+
+#include "Color.h"
+#include "ShaderProgram.h"
+#include "StbTrueType.h"
+
+// Texto na janela com um atlas de glifos: os caracteres ASCII 32..126 são
+// rasterizados uma vez (stbtt_BakeFontBitmap) numa textura GL_R8 e cada quadro
+// junta os quads de todos os textos e retângulos num único VBO e num draw só.
+//
+//   TextRenderer text;  text.init();               // FCG_FONT ou fontes do sistema
+//   text.print(8, 8, "FPS 60", canvasColor(1, 1, 1));
+//   text.draw(w, h);
+//
+// Coordenadas em pixels do framebuffer, origem no canto superior esquerdo; y é
+// o topo da linha. Um texel branco no canto do atlas serve para os retângulos
+// sólidos, então fundo, gráficos e texto saem no mesmo draw.
+struct TextVertex
+{
+    float x, y, u, v;
+    uint32_t color;
+};
+
+// Primeira fonte que existir: FCG_FONT, assets/fonts/ e caminhos comuns do sistema
+inline std::string findHudFont()
+{
+    std::vector<std::string> candidates;
+    if (const char *env = std::getenv("FCG_FONT"))
+        candidates.push_back(env);
+    candidates.push_back("assets/fonts/hud.ttf");
+    candidates.push_back("/usr/share/fonts/truetype/dejavu/DejaVuSansMono.ttf");
+    candidates.push_back("/usr/share/fonts/TTF/DejaVuSansMono.ttf");
+    candidates.push_back("/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf");
+    candidates.push_back("/System/Library/Fonts/Menlo.ttc");
+    candidates.push_back("C:/Windows/Fonts/consola.ttf");
+    for (const std::string &path : candidates)
+        if (FILE *f = std::fopen(path.c_str(), "rb"))
+        {
+            std::fclose(f);
+            return path;
+        }
+    return std::string();
+}
+
+class TextRenderer
+{
+public:
+    static const int atlasWidth = 512, atlasHeight = 256;
+    static const int firstChar = 32, charCount = 95;
+
+    // Falha (false) sem fonte ou sem espaço no atlas; o exercício segue sem HUD
+    bool init(const std::string &fontPath = findHudFont(), float pixelHeight = 16.0f)
+    {
+        std::vector<unsigned char> ttf;
+        if (!readFile(fontPath, ttf))
+        {
+            std::cerr << "TextRenderer: fonte nao encontrada (defina FCG_FONT)" << std::endl;
+            return false;
+        }
+        std::vector<unsigned char> bitmap(atlasWidth * atlasHeight, 0);
+        int rows = stbtt_BakeFontBitmap(ttf.data(), 0, pixelHeight, bitmap.data(), atlasWidth, atlasHeight,
+                                        firstChar, charCount, glyphs);
+        if (rows <= 0 || rows > atlasHeight - 2)
+        {
+            std::cerr << "TextRenderer: " << fontPath << " nao coube no atlas" << std::endl;
+            return false;
+        }
+        for (int y = atlasHeight - 2; y < atlasHeight; ++y)
+            for (int x = atlasWidth - 2; x < atlasWidth; ++x)
+                bitmap[y * atlasWidth + x] = 255;
+        lineHeightPx = pixelHeight;
+
+        glGenTextures(1, &atlas);
+        glBindTexture(GL_TEXTURE_2D, atlas);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, atlasWidth, atlasHeight, 0, GL_RED, GL_UNSIGNED_BYTE, bitmap.data());
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        program = link();
+        if (!program)
+            return false;
+        viewportLoc = glGetUniformLocation(program, "viewport");
+        GLint previous;
+        glGetIntegerv(GL_CURRENT_PROGRAM, &previous);
+        glUseProgram(program);
+        glUniform1i(glGetUniformLocation(program, "atlas"), 0);
+        glUseProgram(previous);
+
+        glGenVertexArrays(1, &vao);
+        glGenBuffers(1, &vbo);
+        glBindVertexArray(vao);
+        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, sizeof(TextVertex), (GLvoid *)0);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(TextVertex), (GLvoid *)(4 * sizeof(float)));
+        glEnableVertexAttribArray(1);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindVertexArray(0);
+        return true;
+    }
+
+    float lineHeight() const { return lineHeightPx; }
+
+    // Largura em pixels (só avanços, sem kerning)
+    float width(const char *s) const
+    {
+        float w = 0.0f;
+        for (; *s; ++s)
+            if (*s >= firstChar && *s < firstChar + charCount)
+                w += glyphs[*s - firstChar].xadvance;
+        return w;
+    }
+
+    // Devolve o x depois do último caractere
+    float print(float x, float y, const char *s, uint32_t color)
+    {
+        float baseline = y + lineHeightPx * 0.8f;
+        for (; *s; ++s)
+        {
+            if (*s < firstChar || *s >= firstChar + charCount)
+                continue;
+            stbtt_aligned_quad q;
+            stbtt_GetBakedQuad(glyphs, atlasWidth, atlasHeight, *s - firstChar, &x, &baseline, &q, 1);
+            if (q.x1 > q.x0)
+                quad(q.x0, q.y0, q.x1, q.y1, q.s0, q.t0, q.s1, q.t1, color);
+        }
+        return x;
+    }
+
+    void rect(float x0, float y0, float x1, float y1, uint32_t color)
+    {
+        float u = (atlasWidth - 1.0f) / atlasWidth, v = (atlasHeight - 1.0f) / atlasHeight;
+        quad(x0, y0, x1, y1, u, v, u, v, color);
+    }
+
+    // Envia tudo o que foi acumulado desde o último draw, com mistura alfa
+    void draw(int w, int h)
+    {
+        size_t count = vertices.size();
+        if (count == 0)
+            return;
+        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        size_t bytes = count * sizeof(TextVertex);
+        if (bytes > capacity)
+        {
+            capacity = bytes * 2;
+            glBufferData(GL_ARRAY_BUFFER, capacity, NULL, GL_STREAM_DRAW);
+        }
+        else
+        {
+            glBufferData(GL_ARRAY_BUFFER, capacity, NULL, GL_STREAM_DRAW); // órfão
+        }
+        glBufferSubData(GL_ARRAY_BUFFER, 0, bytes, vertices.data());
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+        GLint previous;
+        glGetIntegerv(GL_CURRENT_PROGRAM, &previous);
+        glUseProgram(program);
+        glUniform2f(viewportLoc, static_cast<float>(w), static_cast<float>(h));
+        glEnable(GL_BLEND);
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, atlas);
+        glBindVertexArray(vao);
+        glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(count));
+        glBindVertexArray(0);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        glDisable(GL_BLEND);
+        glUseProgram(previous);
+        quads = count / 6;
+        vertices.clear();
+    }
+
+    // Quads enviados no último draw
+    size_t quadCount() const { return quads; }
+
+    void release()
+    {
+        glDeleteProgram(program);
+        glDeleteBuffers(1, &vbo);
+        glDeleteVertexArrays(1, &vao);
+        glDeleteTextures(1, &atlas);
+        program = vbo = vao = atlas = 0;
+    }
+
+private:
+    void quad(float x0, float y0, float x1, float y1, float s0, float t0, float s1, float t1, uint32_t color)
+    {
+        vertices.push_back({x0, y0, s0, t0, color});
+        vertices.push_back({x1, y0, s1, t0, color});
+        vertices.push_back({x1, y1, s1, t1, color});
+        vertices.push_back({x0, y0, s0, t0, color});
+        vertices.push_back({x1, y1, s1, t1, color});
+        vertices.push_back({x0, y1, s0, t1, color});
+    }
+
+    static bool readFile(const std::string &path, std::vector<unsigned char> &out)
+    {
+        if (path.empty())
+            return false;
+        FILE *f = std::fopen(path.c_str(), "rb");
+        if (!f)
+            return false;
+        std::fseek(f, 0, SEEK_END);
+        long size = std::ftell(f);
+        std::fseek(f, 0, SEEK_SET);
+        out.resize(size > 0 ? size : 0);
+        bool ok = size > 0 && std::fread(out.data(), 1, out.size(), f) == out.size();
+        std::fclose(f);
+        return ok;
+    }
+
+    static GLuint link()
+    {
+        static const GLchar *vsText = R"(
+ #version 400
+ layout (location = 0) in vec4 positionUv;
+ layout (location = 1) in vec4 vertexColor;
+ uniform vec2 viewport;
+ out vec2 uv;
+ out vec4 vColor;
+ void main()
+ {
+	 uv = positionUv.zw;
+	 vColor = vertexColor;
+	 vec2 ndc = positionUv.xy / viewport * 2.0 - 1.0;
+	 gl_Position = vec4(ndc.x, -ndc.y, 0.0, 1.0);
+ }
+ )";
+        static const GLchar *fsText = R"(
+ #version 400
+ uniform sampler2D atlas;
+ in vec2 uv;
+ in vec4 vColor;
+ out vec4 color;
+ void main()
+ {
+	 color = vec4(vColor.rgb, vColor.a * texture(atlas, uv).r);
+ }
+ )";
+        return linkProgram(vsText, fsText, "TextRenderer");
+    }
+
+    stbtt_bakedchar glyphs[charCount];
+    float lineHeightPx = 16.0f;
+    GLuint program = 0, vao = 0, vbo = 0, atlas = 0;
+    GLint viewportLoc = -1;
+    std::vector<TextVertex> vertices;
+    size_t capacity = 0, quads = 0;
+};
+
+// Painel de estatísticas no canto superior esquerdo: FPS e tempo de quadro
+// (média e pior caso das últimas `historySize` amostras), um gráfico de barras
+// do tempo de cada quadro com a linha de 60 Hz e contadores do exercício.
+//
+//   StatsHud hud;  hud.init();
+//   // no loop, depois do desenho (e de regressionFrame, para não entrar na imagem)
+//   hud.frame(dt);  hud.counter("draws", 12);  hud.draw(w, h);
+//
+// O próprio custo de CPU do painel (montar os quads e enviar) aparece na
+// última linha; fica na casa de centésimos de milissegundo.
+class StatsHud
+{
+public:
+    static constexpr int historySize = 120;
+
+    bool init(const std::string &fontPath = findHudFont())
+    {
+        ready = text.init(fontPath);
+        return ready;
+    }
+
+    bool enabled() const { return ready; }
+
+    // Duração do último quadro em segundos
+    void frame(double dtSeconds)
+    {
+        history[next] = static_cast<float>(dtSeconds * 1000.0);
+        next = (next + 1) % historySize;
+        filled = std::min(filled + 1, historySize);
+        counters.clear();
+    }
+
+    // Uma linha "nome: valor" neste quadro (nome literal: o ponteiro é guardado até draw)
+    void counter(const char *name, double value)
+    {
+        counters.push_back({name, value});
+    }
+
+    void draw(int w, int h)
+    {
+        if (!ready)
+            return;
+        auto start = std::chrono::steady_clock::now();
+
+        float sum = 0.0f, worst = 0.0f;
+        for (int i = 0; i < filled; ++i)
+        {
+            sum += history[i];
+            worst = std::max(worst, history[i]);
+        }
+        float mean = filled ? sum / filled : 0.0f;
+
+        const float pad = 6.0f, graphH = 48.0f, barW = 2.0f, scaleMs = 33.3f;
+        float line = text.lineHeight();
+        int lines = 2 + static_cast<int>(counters.size());
+        float panelW = historySize * barW + 2 * pad;
+        float panelH = pad + lines * line + pad + graphH + pad;
+        text.rect(0, 0, panelW, panelH, canvasColor(0, 0, 0, 0.6f));
+
+        const uint32_t white = canvasColor(1, 1, 1), gray = canvasColor(0.7f, 0.7f, 0.7f);
+        char buf[96];
+        float y = pad;
+        std::snprintf(buf, sizeof(buf), "FPS %.1f  %.2f ms (max %.2f)", mean > 0 ? 1000.0f / mean : 0.0f, mean, worst);
+        text.print(pad, y, buf, white);
+        y += line;
+        for (const Counter &c : counters)
+        {
+            std::snprintf(buf, sizeof(buf), "%s: %.6g", c.name, c.value);
+            text.print(pad, y, buf, white);
+            y += line;
+        }
+        std::snprintf(buf, sizeof(buf), "hud %.3f ms, %zu quads", overhead, text.quadCount());
+        text.print(pad, y, buf, gray);
+        y += line + pad;
+
+        // Barras do mais antigo (esquerda) para o mais recente (direita)
+        float bottom = y + graphH;
+        for (int i = 0; i < filled; ++i)
+        {
+            float ms = history[(next - filled + i + historySize) % historySize];
+            float bh = std::min(ms / scaleMs, 1.0f) * graphH;
+            uint32_t color = ms <= 16.7f ? canvasColor(0.2f, 0.9f, 0.3f)
+                           : ms <= 33.3f ? canvasColor(1.0f, 0.8f, 0.1f) : canvasColor(1.0f, 0.2f, 0.2f);
+            float x = pad + (historySize - filled + i) * barW;
+            text.rect(x, bottom - bh, x + barW, bottom, color);
+        }
+        float target = bottom - 16.7f / scaleMs * graphH;
+        text.rect(pad, target, pad + historySize * barW, target + 1.0f, canvasColor(1, 1, 1, 0.5f));
+
+        text.draw(w, h);
+        overhead = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // Custo de CPU do último draw(), em ms
+    double overheadMs() const { return overhead; }
+
+    void release() { text.release(); }
+
+private:
+    struct Counter
+    {
+        const char *name;
+        double value;
+    };
+
+    TextRenderer text;
+    bool ready = false;
+    float history[historySize] = {};
+    int next = 0, filled = 0;
+    std::vector<Counter> counters;
+    double overhead = 0.0;
+};
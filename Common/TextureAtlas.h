@@ -0,0 +1,333 @@
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <glad/glad.h>
+
+#include "StbImage.h"
+
+// Empacotador "skyline" (bottom-left): guarda só o contorno superior das áreas
+// ocupadas e coloca cada retângulo na posição que deixa o topo mais baixo.
+// Não depende da OpenGL.
+class SkylinePacker
+{
+public:
+    SkylinePacker(int width = 0, int height = 0) { reset(width, height); }
+
+    void reset(int width, int height)
+    {
+        w = width;
+        h = height;
+        skyline.assign(1, {0, 0, width});
+        used = 0;
+    }
+
+    // Tenta reservar um retângulo w x h; devolve false se não couber
+    bool insert(int rw, int rh, int &outX, int &outY)
+    {
+        int bestIndex = -1, bestTop = h + 1, bestWidth = w + 1, bestY = 0;
+        for (size_t i = 0; i < skyline.size(); ++i)
+        {
+            int y;
+            if (!fits(i, rw, rh, y))
+                continue;
+            int top = y + rh;
+            if (top < bestTop || (top == bestTop && skyline[i].width < bestWidth))
+            {
+                bestIndex = static_cast<int>(i);
+                bestTop = top;
+                bestWidth = skyline[i].width;
+                bestY = y;
+            }
+        }
+        if (bestIndex < 0)
+            return false;
+
+        outX = skyline[bestIndex].x;
+        outY = bestY;
+        addLevel(bestIndex, outX, bestY + rh, rw);
+        used += static_cast<long long>(rw) * rh;
+        return true;
+    }
+
+    // Fração da página efetivamente ocupada
+    float occupancy() const { return w > 0 && h > 0 ? float(used) / (float(w) * h) : 0.0f; }
+
+private:
+    struct Node
+    {
+        int x, y, width;
+    };
+
+    bool fits(size_t index, int rw, int rh, int &y) const
+    {
+        int x = skyline[index].x;
+        if (x + rw > w)
+            return false;
+        int left = rw;
+        y = skyline[index].y;
+        for (size_t i = index; left > 0; ++i)
+        {
+            if (i >= skyline.size())
+                return false;
+            y = std::max(y, skyline[i].y);
+            if (y + rh > h)
+                return false;
+            left -= skyline[i].width;
+        }
+        return true;
+    }
+
+    void addLevel(int index, int x, int y, int width)
+    {
+        skyline.insert(skyline.begin() + index, {x, y, width});
+
+        // Recorta os trechos que ficaram embaixo do novo nível
+        for (size_t i = index + 1; i < skyline.size(); ++i)
+        {
+            const Node &prev = skyline[i - 1];
+            int prevEnd = prev.x + prev.width;
+            if (skyline[i].x >= prevEnd)
+                break;
+            int shrink = prevEnd - skyline[i].x;
+            skyline[i].x += shrink;
+            skyline[i].width -= shrink;
+            if (skyline[i].width > 0)
+                break;
+            skyline.erase(skyline.begin() + i);
+            --i;
+        }
+
+        // Junta vizinhos na mesma altura
+        for (size_t i = 0; i + 1 < skyline.size(); ++i)
+        {
+            if (skyline[i].y == skyline[i + 1].y)
+            {
+                skyline[i].width += skyline[i + 1].width;
+                skyline.erase(skyline.begin() + i + 1);
+                --i;
+            }
+        }
+    }
+
+    int w = 0, h = 0;
+    long long used = 0;
+    std::vector<Node> skyline;
+};
+
+// Região de uma imagem dentro do atlas: coordenadas de textura e camada
+struct AtlasRegion
+{
+    float u0, v0, u1, v1;
+    int layer;
+};
+
+// Atlas de texturas: junta muitas imagens pequenas em poucas páginas grandes,
+// guardadas como camadas de uma única GL_TEXTURE_2D_ARRAY. Com isso uma cena
+// inteira com texturas diferentes usa um só bind e pode sair numa só chamada
+// de desenho, lendo a região de cada imagem na tabela de remapeamento.
+//
+// Cada imagem recebe uma borda ("gutter") com os pixels da beirada repetidos.
+// Uma imagem que o shader repete com fract() (add com wrap = true) recebe na
+// borda os pixels do lado oposto, como GL_REPEAT: o filtro bilinear e os
+// mipmaps na emenda da repetição leem a continuação da imagem, sem costura.
+// Posições e tamanhos são múltiplos do gutter e o número de níveis de mipmap
+// é limitado a log2(gutter), então os níveis reduzidos não misturam imagens
+// vizinhas.
+//
+// No shader, com a tabela ligada como samplerBuffer (dois texels por região):
+//     vec4 r = texelFetch(remap, 2 * id);            // u0, v0, u1, v1
+//     float layer = texelFetch(remap, 2 * id + 1).x;
+//     vec3 uvw = vec3(mix(r.xy, r.zw, localUV), layer);
+class TextureAtlas
+{
+public:
+    explicit TextureAtlas(int pageSize = 1024, int gutter = 4)
+        : size(pageSize), gutter(std::max(1, gutter))
+    {
+        while ((2 << mipLevels) <= this->gutter)
+            ++mipLevels;
+    }
+
+    // Adiciona uma imagem RGBA8; devolve o identificador da região ou -1 se a
+    // imagem (com borda) for maior que uma página. Pode ser chamada a qualquer
+    // momento; a GPU só é atualizada no próximo flush().
+    int add(const unsigned char *rgba, int w, int h, bool wrap = false)
+    {
+        int rw = alignUp(w + 2 * gutter), rh = alignUp(h + 2 * gutter);
+        if (rw > size || rh > size)
+            return -1;
+
+        int x = 0, y = 0;
+        size_t page = 0;
+        for (; page < pages.size(); ++page)
+            if (pages[page].packer.insert(rw, rh, x, y))
+                break;
+        if (page == pages.size())
+        {
+            pages.emplace_back();
+            pages.back().packer.reset(size, size);
+            pages.back().pixels.assign(static_cast<size_t>(size) * size * 4, 0);
+            pages.back().packer.insert(rw, rh, x, y);
+        }
+
+        blit(pages[page], rgba, w, h, x, y, wrap);
+        pages[page].dirty = true;
+
+        float inv = 1.0f / size;
+        int id = static_cast<int>(table.size());
+        table.push_back({(x + gutter) * inv, (y + gutter) * inv,
+                         (x + gutter + w) * inv, (y + gutter + h) * inv,
+                         static_cast<int>(page)});
+        tableDirty = true;
+        return id;
+    }
+
+    int addFile(const std::string &path, bool wrap = false)
+    {
+        int w, h;
+        unsigned char *data = stbi_load(path.c_str(), &w, &h, nullptr, 4);
+        if (!data)
+            return -1;
+        int id = add(data, w, h, wrap);
+        stbi_image_free(data);
+        return id;
+    }
+
+    // Envia para a GPU as páginas alteradas e a tabela de remapeamento
+    void flush()
+    {
+        if (!texture || allocatedLayers != static_cast<int>(pages.size()))
+        {
+            // Página nova: realoca o array inteiro e reenvia tudo
+            if (!texture)
+                glGenTextures(1, &texture);
+            glBindTexture(GL_TEXTURE_2D_ARRAY, texture);
+            allocatedLayers = static_cast<int>(pages.size());
+            glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, size, size, allocatedLayers, 0,
+                         GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+            glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL, mipLevels);
+            glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            for (Page &p : pages)
+                p.dirty = true;
+        }
+        else
+            glBindTexture(GL_TEXTURE_2D_ARRAY, texture);
+
+        bool any = false;
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        for (size_t i = 0; i < pages.size(); ++i)
+        {
+            if (!pages[i].dirty)
+                continue;
+            glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, static_cast<GLint>(i), size, size, 1,
+                            GL_RGBA, GL_UNSIGNED_BYTE, pages[i].pixels.data());
+            pages[i].dirty = false;
+            any = true;
+        }
+        if (any && mipLevels > 0)
+            glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+
+        if (tableDirty)
+            uploadTable();
+    }
+
+    const AtlasRegion &region(int id) const { return table[id]; }
+    const std::vector<AtlasRegion> &regions() const { return table; }
+
+    // Converte uma coordenada local (0..1 dentro da imagem) para o atlas
+    void remap(int id, float u, float v, float &outU, float &outV) const
+    {
+        const AtlasRegion &r = table[id];
+        outU = r.u0 + (r.u1 - r.u0) * u;
+        outV = r.v0 + (r.v1 - r.v0) * v;
+    }
+
+    GLuint arrayTexture() const { return texture; }
+    GLuint remapTexture() const { return tableTexture; } // GL_TEXTURE_BUFFER, RGBA32F
+    int pageCount() const { return static_cast<int>(pages.size()); }
+
+    void release()
+    {
+        if (texture)
+            glDeleteTextures(1, &texture);
+        if (tableTexture)
+            glDeleteTextures(1, &tableTexture);
+        if (tableBuffer)
+            glDeleteBuffers(1, &tableBuffer);
+        texture = tableTexture = tableBuffer = 0;
+        allocatedLayers = 0;
+    }
+
+private:
+    struct Page
+    {
+        SkylinePacker packer;
+        std::vector<unsigned char> pixels;
+        bool dirty = false;
+    };
+
+    int alignUp(int v) const { return (v + gutter - 1) / gutter * gutter; }
+
+    // Copia a imagem para a página e preenche o gutter: com os pixels da beirada
+    // ou, com wrap, com os do lado oposto
+    void blit(Page &page, const unsigned char *rgba, int w, int h, int x, int y, bool wrap)
+    {
+        int rw = alignUp(w + 2 * gutter), rh = alignUp(h + 2 * gutter);
+        auto source = [wrap](int p, int n) { return wrap ? ((p % n) + n) % n : std::min(std::max(p, 0), n - 1); };
+        for (int py = 0; py < rh; ++py)
+        {
+            int sy = source(py - gutter, h);
+            unsigned char *dst = &page.pixels[(static_cast<size_t>(y + py) * size + x) * 4];
+            const unsigned char *src = rgba + static_cast<size_t>(sy) * w * 4;
+            for (int px = 0; px < rw; ++px)
+            {
+                int sx = source(px - gutter, w);
+                std::memcpy(dst + px * 4, src + sx * 4, 4);
+            }
+        }
+    }
+
+    void uploadTable()
+    {
+        std::vector<float> data;
+        data.reserve(table.size() * 8);
+        for (const AtlasRegion &r : table)
+        {
+            float texels[8] = {r.u0, r.v0, r.u1, r.v1, static_cast<float>(r.layer), 0.0f, 0.0f, 0.0f};
+            data.insert(data.end(), texels, texels + 8);
+        }
+
+        if (!tableBuffer)
+        {
+            glGenBuffers(1, &tableBuffer);
+            glGenTextures(1, &tableTexture);
+        }
+        glBindBuffer(GL_TEXTURE_BUFFER, tableBuffer);
+        glBufferData(GL_TEXTURE_BUFFER, data.size() * sizeof(float), data.data(), GL_STATIC_DRAW);
+        glBindTexture(GL_TEXTURE_BUFFER, tableTexture);
+        glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, tableBuffer);
+        glBindTexture(GL_TEXTURE_BUFFER, 0);
+        glBindBuffer(GL_TEXTURE_BUFFER, 0);
+        tableDirty = false;
+    }
+
+    int size;
+    int gutter;
+    int mipLevels = 0;
+
+    std::vector<Page> pages;
+    std::vector<AtlasRegion> table;
+    bool tableDirty = false;
+
+    GLuint texture = 0;
+    int allocatedLayers = 0;
+    GLuint tableBuffer = 0, tableTexture = 0;
+};
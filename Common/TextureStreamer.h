@@ -0,0 +1,276 @@
+#pragma once
+
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <glad/glad.h>
+
+#include "StbImage.h"
+#include "TextureAtlas.h"
+#include "ThreadPool.h"
+#include "Trace.h"
+
+// Carregamento assíncrono de texturas.
+//
+// A decodificação (stb_image) roda nas threads do ThreadPool; a thread principal
+// só copia os pixels já prontos para um PBO (pixel buffer object) e pede a
+// glTexImage2D a partir dele, de modo que a transferência para a GPU corre em
+// paralelo com o desenho. Enquanto a imagem não chega, texture() devolve uma
+// textura branca 1x1, então a cena nunca espera pelo disco.
+//
+// Com loadInto() a imagem decodificada vai para uma região de um TextureAtlas
+// em vez de uma textura própria: quando ready() vira true, region() tem o
+// identificador e quem desenha chama flush() do atlas.
+//
+// Uso: criar depois do gladLoadGLLoader, chamar load() uma vez por arquivo,
+// update() uma vez por quadro e release() antes do glfwTerminate.
+class TextureStreamer
+{
+public:
+    explicit TextureStreamer(unsigned workers = 0, int pboCount = 3)
+        : pbos(pboCount > 0 ? pboCount : 1)
+    {
+        const unsigned char white[4] = {255, 255, 255, 255};
+        glGenTextures(1, &placeholder);
+        glBindTexture(GL_TEXTURE_2D, placeholder);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, white);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        for (Pbo &p : pbos)
+            glGenBuffers(1, &p.id);
+
+        pool.reset(new ThreadPool(workers));
+    }
+
+    ~TextureStreamer()
+    {
+        pool.reset(); // espera as decodificações pendentes terminarem
+        for (Decoded &d : decoded)
+            stbi_image_free(d.pixels);
+    }
+
+    TextureStreamer(const TextureStreamer &) = delete;
+    TextureStreamer &operator=(const TextureStreamer &) = delete;
+
+    // Agenda a decodificação do arquivo e devolve um identificador para texture()
+    int load(const std::string &path)
+    {
+        int handle = static_cast<int>(slots.size());
+        slots.push_back({placeholder, false, path, nullptr, -1, false});
+        decode(handle, path);
+        return handle;
+    }
+
+    // Agenda a decodificação do arquivo para uma região do atlas; wrap como em
+    // TextureAtlas::add, para imagens que o shader repete
+    int loadInto(TextureAtlas &atlas, const std::string &path, bool wrap = false)
+    {
+        int handle = static_cast<int>(slots.size());
+        slots.push_back({placeholder, false, path, &atlas, -1, wrap});
+        decode(handle, path);
+        return handle;
+    }
+
+    GLuint texture(int handle) const { return slots[handle].texture; }
+    bool ready(int handle) const { return slots[handle].ready; }
+    // true enquanto algum load() ainda não terminou (nem com erro)
+    bool busy() const { return finished < slots.size(); }
+    int region(int handle) const { return slots[handle].region; } // -1 até ready()
+
+    // Envia para a GPU as imagens que já foram decodificadas, até byteBudget
+    // bytes por chamada, para que um lote grande não segure o quadro.
+    void update(size_t byteBudget = 8u << 20)
+    {
+        std::vector<Decoded> batch;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            batch.swap(decoded);
+        }
+
+        size_t used = 0;
+        size_t i = 0;
+        for (; i < batch.size(); ++i)
+        {
+            Decoded &d = batch[i];
+            if (!d.pixels)
+            {
+                std::cerr << "Falha ao carregar " << slots[d.handle].path << ": " << d.error << std::endl;
+                ++finished;
+                continue;
+            }
+
+            size_t bytes = static_cast<size_t>(d.width) * d.height * 4;
+            if (used > 0 && used + bytes > byteBudget)
+                break;
+
+            Slot &slot = slots[d.handle];
+            if (slot.atlas)
+            {
+                // Só a cópia para a página na CPU; a GPU recebe no flush() do atlas
+                slot.region = slot.atlas->add(d.pixels, d.width, d.height, slot.wrap);
+                if (slot.region < 0)
+                    std::cerr << slot.path << " não cabe numa página do atlas" << std::endl;
+                slot.ready = slot.region >= 0;
+                stbi_image_free(d.pixels);
+                d.pixels = nullptr;
+                used += bytes;
+                ++finished;
+                continue;
+            }
+
+            Pbo *pbo = acquirePbo();
+            if (!pbo)
+                break; // todos os PBOs ainda estão em uso pela GPU
+
+            upload(*pbo, d, bytes);
+            ++finished;
+            stbi_image_free(d.pixels);
+            d.pixels = nullptr;
+            used += bytes;
+        }
+
+        // O que não coube neste quadro volta para a fila
+        if (i < batch.size())
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            decoded.insert(decoded.begin(), std::make_move_iterator(batch.begin() + i),
+                           std::make_move_iterator(batch.end()));
+        }
+    }
+
+    // Libera os objetos OpenGL (precisa do contexto ainda ativo)
+    void release()
+    {
+        for (Slot &s : slots)
+        {
+            if (s.texture != placeholder)
+                glDeleteTextures(1, &s.texture);
+            s.texture = 0;
+        }
+        for (Pbo &p : pbos)
+        {
+            if (p.fence)
+                glDeleteSync(p.fence);
+            glDeleteBuffers(1, &p.id);
+            p = Pbo();
+        }
+        if (placeholder)
+            glDeleteTextures(1, &placeholder);
+        placeholder = 0;
+    }
+
+private:
+    struct Slot
+    {
+        GLuint texture;
+        bool ready;
+        std::string path;
+        TextureAtlas *atlas; // nullptr: textura própria
+        int region;
+        bool wrap; // gutter do atlas com os texels do lado oposto
+    };
+
+    struct Decoded
+    {
+        int handle = -1;
+        int width = 0, height = 0;
+        unsigned char *pixels = nullptr;
+        std::string error;
+    };
+
+    struct Pbo
+    {
+        GLuint id = 0;
+        GLsync fence = nullptr;
+        size_t capacity = 0;
+    };
+
+    void decode(int handle, const std::string &path)
+    {
+        pool->submit([this, handle, path] {
+            TRACE_SCOPE("decodifica imagem");
+            Decoded d;
+            d.handle = handle;
+            d.pixels = stbi_load(path.c_str(), &d.width, &d.height, nullptr, 4);
+            if (!d.pixels)
+                d.error = stbi_failure_reason();
+            std::lock_guard<std::mutex> lock(mutex);
+            decoded.push_back(std::move(d));
+        });
+    }
+
+    // Devolve um PBO cuja cópia anterior já terminou, sem bloquear
+    Pbo *acquirePbo()
+    {
+        for (Pbo &p : pbos)
+        {
+            if (!p.fence)
+                return &p;
+            GLenum state = glClientWaitSync(p.fence, 0, 0);
+            if (state == GL_ALREADY_SIGNALED || state == GL_CONDITION_SATISFIED)
+            {
+                glDeleteSync(p.fence);
+                p.fence = nullptr;
+                return &p;
+            }
+        }
+        return nullptr;
+    }
+
+    void upload(Pbo &pbo, const Decoded &d, size_t bytes)
+    {
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo.id);
+        if (bytes > pbo.capacity)
+        {
+            glBufferData(GL_PIXEL_UNPACK_BUFFER, bytes, nullptr, GL_STREAM_DRAW);
+            pbo.capacity = bytes;
+        }
+        void *dst = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, bytes,
+                                     GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+        if (!dst)
+        {
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            return;
+        }
+        std::memcpy(dst, d.pixels, bytes);
+        glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+
+        GLuint tex;
+        glGenTextures(1, &tex);
+        glBindTexture(GL_TEXTURE_2D, tex);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        // Com um PBO ligado, o último argumento é um deslocamento dentro do buffer
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, d.width, d.height, 0, GL_RGBA, GL_UNSIGNED_BYTE, (GLvoid *)0);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+        glGenerateMipmap(GL_TEXTURE_2D);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        pbo.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+        // Troca a textura provisória pela definitiva
+        Slot &slot = slots[d.handle];
+        slot.texture = tex;
+        slot.ready = true;
+    }
+
+    GLuint placeholder = 0;
+    std::vector<Slot> slots;
+    size_t finished = 0; // load() já enviados ou descartados por erro
+    std::vector<Pbo> pbos;
+
+    std::mutex mutex;
+    std::vector<Decoded> decoded; // protegido por mutex
+
+    std::unique_ptr<ThreadPool> pool; // destruído primeiro (declarado por último)
+};
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+// Pool simples de threads de trabalho: as tarefas entram numa fila FIFO e são
+// executadas pela primeira thread livre. Não toca em nada da OpenGL, então as
+// tarefas não podem chamar funções gl* (o contexto pertence à thread principal).
+class ThreadPool
+{
+public:
+    explicit ThreadPool(unsigned count = 0)
+    {
+        if (count == 0)
+        {
+            unsigned hw = std::thread::hardware_concurrency();
+            count = hw > 1 ? hw - 1 : 1; // deixa um núcleo para o loop de render
+        }
+        for (unsigned i = 0; i < count; ++i)
+            workers.emplace_back([this] { run(); });
+    }
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        cv.notify_all();
+        for (std::thread &t : workers)
+            t.join();
+    }
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    void submit(std::function<void()> task)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            tasks.push(std::move(task));
+        }
+        cv.notify_one();
+    }
+
+    size_t size() const { return workers.size(); }
+
+private:
+    void run()
+    {
+        for (;;)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                cv.wait(lock, [this] { return stopping || !tasks.empty(); });
+                if (stopping && tasks.empty())
+                    return;
+                task = std::move(tasks.front());
+                tasks.pop();
+            }
+            task();
+        }
+    }
+
+    std::vector<std::thread> workers;
+    std::queue<std::function<void()>> tasks;
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool stopping = false;
+};
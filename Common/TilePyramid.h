@@ -0,0 +1,524 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <glad/glad.h>
+
+#include "ShaderProgram.h"
+
+// Pirâmide de tiles para ver uma cena enorme de longe, como um mapa: no nível
+// L um tile de tileSize x tileSize texels cobre tileSize * 2^L unidades do
+// mundo, e com zoom <= maxZoom a tela é montada com os tiles do nível em que
+// um texel é no máximo um pixel. Um quadro afastado desenha algumas dezenas
+// (ou centenas, numa tela grande) de quads texturizados num draw instanciado,
+// em vez de milhões de triângulos menores que um pixel.
+//
+// Os tiles são feitos sob demanda, desenhando os triângulos da região numa
+// camada de uma textura 2D array (maxTiles camadas, reaproveitadas da menos
+// usada recentemente). Uma edição marca como sujos os tiles que a cobrem em
+// cada nível já em cache; eles continuam na tela com o conteúdo antigo e são
+// refeitos aos poucos, os mais antigos primeiro. Tiles que ainda não existem
+// entram no mesmo orçamento, antes dos sujos e do centro da tela para fora:
+// são feitos até buildBudget triângulos por quadro (ao menos um tile), e até
+// ficarem prontos o lugar deles mostra o recorte do ancestral mais próximo em
+// cache, ou os filhos em cache do nível de baixo, ou nada.
+//
+//   TilePyramid tiles;  tiles.init();
+//   tiles.invalidate(xy);                                     // a cada edição
+//   tiles.update(x0, y0, x1, y1, zoom, vao, ranges);          // depois do upload
+//   if (tiles.active(zoom)) tiles.draw(projection); else ...  // desenho direto
+//
+// ranges(x0, y0, x1, y1, first, count) preenche as faixas de vértices da
+// região (TriangleSlots::visibleRanges); o VAO precisa ter posição (vec2, ou
+// vec3 com z em NDC) no atributo 0 e cor RGBA8 normalizada no atributo 1.
+// Com depthOrder os tiles são feitos com teste de profundidade (GL_LEQUAL)
+// sobre esse z, para sair na mesma ordem do desenho direto (slotDepth).
+class TilePyramid
+{
+public:
+    bool enabled = true;
+    int tileSize = 256;
+    size_t maxTiles = 256;           // camadas da textura (256 KB cada)
+    float maxZoom = 0.25f;           // pixels por unidade abaixo dos quais os tiles entram
+    size_t buildBudget = 1u << 20;   // triângulos por quadro para refazer tiles sujos
+    bool depthOrder = false;         // teste de profundidade ao fazer os tiles (antes de init)
+
+    bool init()
+    {
+        GLint maxLayers = 0;
+        glGetIntegerv(GL_MAX_ARRAY_TEXTURE_LAYERS, &maxLayers);
+        maxTiles = std::min(maxTiles, static_cast<size_t>(std::max(maxLayers, 1)));
+
+        tileProgram = linkProgram(tileVertexSrc, tileFragmentSrc, "TilePyramid");
+        compositeProgram = linkProgram(compositeVertexSrc, compositeFragmentSrc, "TilePyramid");
+        if (!tileProgram || !compositeProgram)
+            return false;
+        tileProjLoc = glGetUniformLocation(tileProgram, "projection");
+        compositeProjLoc = glGetUniformLocation(compositeProgram, "projection");
+        glUseProgram(compositeProgram);
+        glUniform1i(glGetUniformLocation(compositeProgram, "tiles"), 0);
+        glUseProgram(0);
+
+        glGenTextures(1, &texture);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, texture);
+        glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, tileSize, tileSize, static_cast<GLsizei>(maxTiles), 0, GL_RGBA,
+                     GL_UNSIGNED_BYTE, NULL);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+        layerKey.assign(maxTiles, NO_TILE);
+
+        glGenFramebuffers(1, &fbo);
+        if (depthOrder)
+        {
+            glGenRenderbuffers(1, &depthBuffer);
+            glBindRenderbuffer(GL_RENDERBUFFER, depthBuffer);
+            glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, tileSize, tileSize);
+            glBindRenderbuffer(GL_RENDERBUFFER, 0);
+            glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+            glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depthBuffer);
+            glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        }
+
+        // Uma instância por tile: retângulo no mundo e camada
+        glGenVertexArrays(1, &quadVao);
+        glGenBuffers(1, &instanceVbo);
+        glBindVertexArray(quadVao);
+        glBindBuffer(GL_ARRAY_BUFFER, instanceVbo);
+        glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, sizeof(TileInstance), (GLvoid *)0);
+        glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(TileInstance), (GLvoid *)(4 * sizeof(float)));
+        glVertexAttribPointer(2, 1, GL_FLOAT, GL_FALSE, sizeof(TileInstance), (GLvoid *)(8 * sizeof(float)));
+        for (GLuint i = 0; i < 3; ++i)
+        {
+            glEnableVertexAttribArray(i);
+            glVertexAttribDivisor(i, 1);
+        }
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindVertexArray(0);
+        return true;
+    }
+
+    bool active(float zoom) const { return enabled && fbo && zoom <= maxZoom; }
+
+    // Nível em que um texel cobre no máximo um pixel da tela
+    static int levelFor(float zoom) { return std::min(std::max(static_cast<int>(std::floor(std::log2(1.0f / zoom))), 0), MAX_LEVEL); }
+
+    // Triângulo (3 vértices x, y) criado, apagado ou recolorido
+    void invalidate(const float *xy)
+    {
+        invalidate(std::min({xy[0], xy[2], xy[4]}), std::min({xy[1], xy[3], xy[5]}), std::max({xy[0], xy[2], xy[4]}),
+                   std::max({xy[1], xy[3], xy[5]}));
+    }
+
+    void invalidate(float minX, float minY, float maxX, float maxY)
+    {
+        if (tiles.empty())
+            return;
+        for (int level = 0; level <= MAX_LEVEL; ++level)
+        {
+            if (perLevel[level] == 0)
+                continue;
+            float span = spanAt(level);
+            int32_t tx0 = cell(minX, span), tx1 = cell(maxX, span), ty0 = cell(minY, span), ty1 = cell(maxY, span);
+            for (int32_t ty = ty0; ty <= ty1; ++ty)
+                for (int32_t tx = tx0; tx <= tx1; ++tx)
+                {
+                    auto it = tiles.find(key(level, tx, ty));
+                    if (it != tiles.end() && !it->second.dirty)
+                    {
+                        it->second.dirty = true;
+                        it->second.dirtySince = frame;
+                    }
+                }
+        }
+    }
+
+    // Escolhe os tiles da área visível e faz alguns dos que faltam e dos sujos.
+    // Preserva framebuffer, viewport, programa e mistura de quem chamou.
+    template <class Ranges>
+    void update(float minX, float minY, float maxX, float maxY, float zoom, GLuint vao, Ranges ranges)
+    {
+        ++frame;
+        visible.clear();
+        builtNow = 0;
+        if (!active(zoom))
+            return;
+
+        // Nível mais grosso se a tela pedir mais tiles do que cabem na textura
+        int level = levelFor(zoom);
+        float span;
+        int32_t tx0, tx1, ty0, ty1;
+        for (;; ++level)
+        {
+            span = spanAt(level);
+            tx0 = cell(minX, span);
+            tx1 = cell(maxX, span);
+            ty0 = cell(minY, span);
+            ty1 = cell(maxY, span);
+            if (level == MAX_LEVEL || static_cast<size_t>(tx1 - tx0 + 1) * static_cast<size_t>(ty1 - ty0 + 1) <= maxTiles)
+                break;
+        }
+        currentLevel = level;
+
+        std::vector<Tile *> missing, dirty;
+        for (int32_t ty = ty0; ty <= ty1; ++ty)
+            for (int32_t tx = tx0; tx <= tx1; ++tx)
+            {
+                uint64_t k = key(level, tx, ty);
+                auto it = tiles.find(k);
+                if (it == tiles.end())
+                {
+                    Tile t;
+                    t.level = level;
+                    t.x = tx;
+                    t.y = ty;
+                    it = tiles.emplace(k, t).first;
+                    ++perLevel[level];
+                }
+                Tile &t = it->second;
+                t.lastUsed = frame;
+                if (t.layer < 0)
+                    missing.push_back(&t);
+                else if (t.dirty)
+                    dirty.push_back(&t);
+            }
+
+        if (!missing.empty() || !dirty.empty())
+        {
+            SavedState saved;
+            glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+            glViewport(0, 0, tileSize, tileSize);
+            glUseProgram(tileProgram);
+            glEnable(GL_BLEND);
+            glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+            if (depthOrder)
+            {
+                glEnable(GL_DEPTH_TEST);
+                glDepthFunc(GL_LEQUAL);
+            }
+            glBindVertexArray(vao);
+
+            // Os que faltam, do centro da tela para fora, e depois os sujos, os mais
+            // antigos primeiro; todos no mesmo orçamento, com ao menos um tile por quadro
+            float cx = 0.5f * (minX + maxX) / span - 0.5f, cy = 0.5f * (minY + maxY) / span - 0.5f;
+            std::sort(missing.begin(), missing.end(), [cx, cy](const Tile *a, const Tile *b) {
+                return (a->x - cx) * (a->x - cx) + (a->y - cy) * (a->y - cy) <
+                       (b->x - cx) * (b->x - cx) + (b->y - cy) * (b->y - cy);
+            });
+            std::sort(dirty.begin(), dirty.end(), [](const Tile *a, const Tile *b) { return a->dirtySince < b->dirtySince; });
+            size_t spent = 0;
+            for (size_t i = 0; i < missing.size() && (builtNow == 0 || spent < buildBudget); ++i)
+            {
+                Tile *t = missing[i];
+                if ((t->layer = allocateLayer(key(t->level, t->x, t->y))) >= 0)
+                    spent += build(*t, ranges);
+            }
+            for (size_t i = 0; i < dirty.size() && (builtNow == 0 || spent < buildBudget); ++i)
+                spent += build(*dirty[i], ranges);
+
+            glBindVertexArray(0);
+            saved.restore();
+        }
+
+        // Um tile ainda sem camada (fora do orçamento ou textura cheia) sai do mapa
+        // até o próximo quadro; no lugar dele vai o que houver de outro nível
+        for (int32_t ty = ty0; ty <= ty1; ++ty)
+            for (int32_t tx = tx0; tx <= tx1; ++tx)
+            {
+                auto it = tiles.find(key(level, tx, ty));
+                if (it->second.layer < 0)
+                {
+                    --perLevel[level];
+                    tiles.erase(it);
+                    addStandIn(level, tx, ty);
+                    continue;
+                }
+                const Tile &t = it->second;
+                visible.push_back({tx * span, ty * span, (tx + 1) * span, (ty + 1) * span, 0.0f, 1.0f, 1.0f, 0.0f,
+                                   static_cast<float>(t.layer)});
+            }
+        if (!visible.empty())
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, instanceVbo);
+            glBufferData(GL_ARRAY_BUFFER, visible.size() * sizeof(TileInstance), visible.data(), GL_STREAM_DRAW);
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+        }
+    }
+
+    // Compõe os tiles escolhidos em update(); projection: matriz 4x4 por colunas
+    void draw(const float *projection)
+    {
+        if (visible.empty())
+            return;
+        SavedState saved;
+        glUseProgram(compositeProgram);
+        glUniformMatrix4fv(compositeProjLoc, 1, GL_FALSE, projection);
+        glEnable(GL_BLEND);
+        glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA); // tiles em alpha pré-multiplicado
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, texture);
+        glBindVertexArray(quadVao);
+        glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, static_cast<GLsizei>(visible.size()));
+        glBindVertexArray(0);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+        saved.restore();
+    }
+
+    size_t visibleTiles() const { return visible.size(); }
+    size_t builtTiles() const { return builtNow; } // neste quadro
+    size_t cachedTiles() const { return maxTiles - freeLayers(); }
+    int level() const { return currentLevel; }
+
+    void release()
+    {
+        glDeleteProgram(tileProgram);
+        glDeleteProgram(compositeProgram);
+        glDeleteTextures(1, &texture);
+        glDeleteFramebuffers(1, &fbo);
+        glDeleteRenderbuffers(1, &depthBuffer);
+        glDeleteVertexArrays(1, &quadVao);
+        glDeleteBuffers(1, &instanceVbo);
+        tileProgram = compositeProgram = texture = fbo = depthBuffer = quadVao = instanceVbo = 0;
+        tiles.clear();
+        std::fill(perLevel, perLevel + MAX_LEVEL + 1, 0);
+    }
+
+private:
+    static constexpr int MAX_LEVEL = 30;
+    static constexpr uint64_t NO_TILE = ~0ull;
+
+    struct Tile
+    {
+        int level = 0;
+        int32_t x = 0, y = 0;
+        int layer = -1;
+        bool dirty = false;
+        uint64_t dirtySince = 0, lastUsed = 0;
+    };
+
+    // Retângulo no mundo, coordenadas de textura nos cantos (x0, y0) e (x1, y1) e camada
+    struct TileInstance
+    {
+        float x0, y0, x1, y1;
+        float u0, v0, u1, v1;
+        float layer;
+    };
+
+    // Framebuffer, viewport, programa, mistura e profundidade de quem chamou
+    struct SavedState
+    {
+        GLint framebuffer, viewport[4], program, src, dst, depthFunc;
+        GLboolean blend, depthTest;
+
+        SavedState()
+        {
+            glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &framebuffer);
+            glGetIntegerv(GL_VIEWPORT, viewport);
+            glGetIntegerv(GL_CURRENT_PROGRAM, &program);
+            glGetIntegerv(GL_BLEND_SRC_RGB, &src);
+            glGetIntegerv(GL_BLEND_DST_RGB, &dst);
+            blend = glIsEnabled(GL_BLEND);
+            glGetIntegerv(GL_DEPTH_FUNC, &depthFunc);
+            depthTest = glIsEnabled(GL_DEPTH_TEST);
+        }
+
+        void restore() const
+        {
+            glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+            glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+            glUseProgram(program);
+            glBlendFunc(src, dst);
+            if (!blend)
+                glDisable(GL_BLEND);
+            glDepthFunc(depthFunc);
+            if (depthTest)
+                glEnable(GL_DEPTH_TEST);
+            else
+                glDisable(GL_DEPTH_TEST);
+        }
+    };
+
+    float spanAt(int level) const { return std::ldexp(static_cast<float>(tileSize), level); }
+    static int32_t cell(float v, float span) { return static_cast<int32_t>(std::floor(v / span)); }
+
+    static uint64_t key(int level, int32_t tx, int32_t ty)
+    {
+        const uint64_t mask = (1ull << 29) - 1;
+        return (static_cast<uint64_t>(level) << 58) | ((static_cast<uint64_t>(tx + (1 << 28)) & mask) << 29) |
+               (static_cast<uint64_t>(ty + (1 << 28)) & mask);
+    }
+
+    size_t freeLayers() const { return static_cast<size_t>(std::count(layerKey.begin(), layerKey.end(), NO_TILE)); }
+
+    // Camada livre ou a do tile menos usado recentemente que não está na tela
+    int allocateLayer(uint64_t owner)
+    {
+        int best = -1;
+        uint64_t bestUsed = frame;
+        for (size_t i = 0; i < layerKey.size(); ++i)
+        {
+            if (layerKey[i] == NO_TILE)
+            {
+                best = static_cast<int>(i);
+                break;
+            }
+            const Tile &t = tiles.at(layerKey[i]);
+            if (t.lastUsed < bestUsed)
+            {
+                bestUsed = t.lastUsed;
+                best = static_cast<int>(i);
+            }
+        }
+        if (best < 0)
+            return -1;
+        if (layerKey[best] != NO_TILE)
+        {
+            auto it = tiles.find(layerKey[best]);
+            --perLevel[it->second.level];
+            tiles.erase(it);
+        }
+        layerKey[best] = owner;
+        return best;
+    }
+
+    // Substituto de um tile que ainda não foi feito: o recorte do ancestral mais
+    // próximo em cache ou, sem nenhum, os filhos em cache do nível de baixo
+    void addStandIn(int level, int32_t tx, int32_t ty)
+    {
+        float span = spanAt(level);
+        float x0 = tx * span, y0 = ty * span, x1 = x0 + span, y1 = y0 + span;
+        for (int up = level + 1; up <= MAX_LEVEL; ++up)
+        {
+            if (perLevel[up] == 0)
+                continue;
+            float upSpan = spanAt(up);
+            int32_t ax = cell(x0 + 0.5f * span, upSpan), ay = cell(y0 + 0.5f * span, upSpan);
+            auto it = tiles.find(key(up, ax, ay));
+            if (it == tiles.end() || it->second.layer < 0)
+                continue;
+            it->second.lastUsed = frame;
+            float ox = ax * upSpan, oy = ay * upSpan;
+            visible.push_back({x0, y0, x1, y1, (x0 - ox) / upSpan, 1.0f - (y0 - oy) / upSpan, (x1 - ox) / upSpan,
+                               1.0f - (y1 - oy) / upSpan, static_cast<float>(it->second.layer)});
+            return;
+        }
+        if (level == 0)
+            return;
+        float half = 0.5f * span;
+        for (int c = 0; c < 4; ++c)
+        {
+            int32_t cx = 2 * tx + (c & 1), cy = 2 * ty + (c >> 1);
+            auto it = tiles.find(key(level - 1, cx, cy));
+            if (it == tiles.end() || it->second.layer < 0)
+                continue;
+            it->second.lastUsed = frame;
+            visible.push_back({cx * half, cy * half, (cx + 1) * half, (cy + 1) * half, 0.0f, 1.0f, 1.0f, 0.0f,
+                               static_cast<float>(it->second.layer)});
+        }
+    }
+
+    // Desenha os triângulos do tile na sua camada; devolve quantos
+    template <class Ranges>
+    size_t build(Tile &t, Ranges &ranges)
+    {
+        float span = spanAt(t.level);
+        float x0 = t.x * span, y0 = t.y * span, x1 = x0 + span, y1 = y0 + span;
+        glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, texture, 0, t.layer);
+        const GLfloat clear[] = {0.0f, 0.0f, 0.0f, 0.0f};
+        glClearBufferfv(GL_COLOR, 0, clear);
+        if (depthOrder)
+        {
+            const GLfloat far = 1.0f;
+            glClearBufferfv(GL_DEPTH, 0, &far);
+        }
+
+        // Ortográfica com y para baixo, como a câmera: a linha 0 da textura é y1
+        const float projection[16] = {2.0f / (x1 - x0), 0, 0, 0,
+                                      0, 2.0f / (y0 - y1), 0, 0,
+                                      0, 0, -1, 0,
+                                      -(x1 + x0) / (x1 - x0), -(y0 + y1) / (y0 - y1), 0, 1};
+        glUniformMatrix4fv(tileProjLoc, 1, GL_FALSE, projection);
+        ranges(x0, y0, x1, y1, first, count);
+        size_t triangles = 0;
+        for (GLsizei c : count)
+            triangles += static_cast<size_t>(c) / 3;
+        if (!first.empty())
+            glMultiDrawArrays(GL_TRIANGLES, first.data(), count.data(), static_cast<GLsizei>(first.size()));
+        t.dirty = false;
+        ++builtNow;
+        return triangles;
+    }
+
+    // Triângulos da cena em alpha pré-multiplicado (sobre fundo transparente);
+    // o z do atributo 0 passa direto (um VAO com posição vec2 deixa z = 0)
+    static constexpr const GLchar *tileVertexSrc = R"(
+ #version 400
+ layout (location = 0) in vec3 position;
+ layout (location = 1) in vec4 vertexColor;
+ uniform mat4 projection;
+ out vec4 vColor;
+ void main()
+ {
+	 vColor = vec4(vertexColor.rgb * vertexColor.a, vertexColor.a);
+	 gl_Position = projection * vec4(position.xy, 0.0, 1.0);
+	 gl_Position.z = position.z;
+ }
+ )";
+
+    static constexpr const GLchar *tileFragmentSrc = R"(
+ #version 400
+ in vec4 vColor;
+ out vec4 color;
+ void main()
+ {
+	 color = vColor;
+ }
+ )";
+
+    // Quad do tile a partir de gl_VertexID (strip de 4 vértices); texRect é a
+    // parte da camada que cobre o quad (a inteira, ou o recorte de um ancestral)
+    static constexpr const GLchar *compositeVertexSrc = R"(
+ #version 400
+ layout (location = 0) in vec4 rect;
+ layout (location = 1) in vec4 texRect;
+ layout (location = 2) in float layer;
+ uniform mat4 projection;
+ out vec3 uv;
+ void main()
+ {
+	 vec2 corner = vec2(gl_VertexID & 1, gl_VertexID >> 1);
+	 uv = vec3(mix(texRect.xy, texRect.zw, corner), layer);
+	 gl_Position = projection * vec4(mix(rect.xy, rect.zw, corner), 0.0, 1.0);
+ }
+ )";
+
+    static constexpr const GLchar *compositeFragmentSrc = R"(
+ #version 400
+ uniform sampler2DArray tiles;
+ in vec3 uv;
+ out vec4 color;
+ void main()
+ {
+	 color = texture(tiles, uv);
+ }
+ )";
+
+    std::unordered_map<uint64_t, Tile> tiles;
+    std::vector<uint64_t> layerKey; // dono de cada camada
+    size_t perLevel[MAX_LEVEL + 1] = {};
+    std::vector<TileInstance> visible;
+    std::vector<GLint> first;
+    std::vector<GLsizei> count;
+    uint64_t frame = 0;
+    size_t builtNow = 0;
+    int currentLevel = 0;
+
+    GLuint tileProgram = 0, compositeProgram = 0, texture = 0, fbo = 0, depthBuffer = 0, quadVao = 0, instanceVbo = 0;
+    GLint tileProjLoc = -1, compositeProjLoc = -1;
+};
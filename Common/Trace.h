@@ -0,0 +1,166 @@
+#pragma once
+
+// Instrumentação de trechos quentes: TRACE_SCOPE("nome") mede o bloco em que
+// aparece e grava o evento (início + duração) num buffer circular da própria
+// thread. Uma thread de fundo esvazia os buffers periodicamente e escreve no
+// arquivo de trace (formato do Chrome, ver ChromeTrace.h), então a thread
+// medida nunca faz E/S nem pega lock.
+//
+// Só existe quando o programa é compilado com FCG_TRACE definido (opção
+// FCG_TRACE do CMake ou -DFCG_TRACE). Sem isso os macros viram ((void)0).
+//
+// Arquivo de saída: FCG_TRACE_FILE (padrão: trace.json).
+
+#ifdef FCG_TRACE
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ChromeTrace.h"
+
+// Buffer circular de um produtor (a thread dona) e um consumidor (o flusher)
+struct TraceRing
+{
+    static constexpr size_t Capacity = 1 << 14;
+
+    TraceEvent events[Capacity];
+    std::atomic<uint64_t> head{0}; // escrito só pela thread dona
+    std::atomic<uint64_t> tail{0}; // escrito só pelo flusher
+    std::atomic<uint64_t> dropped{0};
+    uint32_t thread = 0;
+
+    void push(const TraceEvent &e)
+    {
+        uint64_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) >= Capacity)
+        {
+            // Flusher atrasado: descarta em vez de bloquear a thread medida
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        events[h % Capacity] = e;
+        head.store(h + 1, std::memory_order_release);
+    }
+
+    template <class F>
+    void drain(F &&sink)
+    {
+        uint64_t t = tail.load(std::memory_order_relaxed);
+        uint64_t h = head.load(std::memory_order_acquire);
+        for (; t < h; ++t)
+            sink(events[t % Capacity]);
+        tail.store(t, std::memory_order_release);
+    }
+};
+
+class Tracer
+{
+public:
+    static Tracer &instance()
+    {
+        static Tracer tracer;
+        return tracer;
+    }
+
+    TraceRing &registerThread()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        rings.emplace_back(new TraceRing());
+        rings.back()->thread = static_cast<uint32_t>(rings.size() - 1);
+        return *rings.back();
+    }
+
+    ~Tracer()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        cv.notify_all();
+        if (flusher.joinable())
+            flusher.join();
+        if (file)
+        {
+            uint64_t dropped = 0;
+            for (auto &r : rings)
+                dropped += r->dropped.load();
+            std::fprintf(file, "\n]}\n");
+            std::fclose(file);
+            if (dropped)
+                std::fprintf(stderr, "[trace] %llu eventos descartados (buffer cheio)\n",
+                             static_cast<unsigned long long>(dropped));
+        }
+    }
+
+private:
+    Tracer()
+    {
+        const char *path = std::getenv("FCG_TRACE_FILE");
+        file = std::fopen(path && *path ? path : "trace.json", "w");
+        if (!file)
+            return;
+        std::fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+        flusher = std::thread([this] { run(); });
+    }
+
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;)
+        {
+            bool last = cv.wait_for(lock, std::chrono::milliseconds(50), [this] { return stopping; });
+            // O lock protege só a lista de anéis; depois de registrada, a
+            // thread medida escreve no seu anel sem nunca tocar nele
+            for (auto &r : rings)
+                r->drain([this](const TraceEvent &e) {
+                    traceWriteEvent(file, e, first);
+                    first = false;
+                });
+            if (last)
+                return;
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<std::unique_ptr<TraceRing>> rings;
+    std::thread flusher;
+    FILE *file = nullptr;
+    bool first = true;
+    bool stopping = false;
+};
+
+inline TraceRing &traceThreadRing()
+{
+    thread_local TraceRing *ring = &Tracer::instance().registerThread();
+    return *ring;
+}
+
+struct TraceScope
+{
+    const char *name;
+    double start;
+
+    explicit TraceScope(const char *n) : name(n), start(traceNowUs()) {}
+    ~TraceScope()
+    {
+        TraceRing &ring = traceThreadRing();
+        ring.push({name, "frame", start, traceNowUs() - start, ring.thread});
+    }
+};
+
+#define TRACE_CONCAT_(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_(a, b)
+#define TRACE_SCOPE(name) TraceScope TRACE_CONCAT(traceScope_, __LINE__)(name)
+
+#else
+
+#define TRACE_SCOPE(name) ((void)0)
+
+#endif
@@ -0,0 +1,503 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <glad/glad.h>
+
+// Vértice do VBO: posição no mundo, profundidade (z em NDC, de slotDepth) e
+// cor RGBA8 (como canvasColor)
+struct SlotVertex
+{
+    float x, y, z;
+    uint32_t color;
+};
+
+// Profundidades distintas num depth buffer de 24 bits, em passos de 2^-22 em NDC
+const uint32_t SLOT_DEPTH_RANKS = 1u << 23;
+
+// Profundidade do triângulo nesta posição da ordem de criação (rank): quanto
+// mais novo, mais perto (z menor). Ranks de SLOT_DEPTH_RANKS em diante ficam
+// todos em -1 e o empate (GL_LEQUAL) volta a ser decidido pela ordem de desenho.
+inline float slotDepth(uint32_t rank)
+{
+    return std::max(1.0f - static_cast<float>(rank + 1.0) * 0x1p-22f, -1.0f);
+}
+
+// Triângulos soltos num VBO, um slot (3 vértices, 48 bytes) por triângulo,
+// agrupados em baldes de uma grade de cellSize x cellSize unidades do mundo
+// (pelo centroide). Cada balde ocupa uma faixa contígua de slots, então os
+// baldes visíveis viram poucas faixas para um glMultiDrawArrays e o custo do
+// desenho acompanha o que está na tela, não o tamanho da cena.
+//
+// Apagar marca o slot como buraco: os três vértices viram (0, 0), um triângulo
+// degenerado que não gera fragmentos, e só esses 48 bytes sobem para a GPU.
+// Com reuseSlots o próximo add() no balde ocupa o buraco (lista livre); a
+// ordem de desenho deixa de ser a de criação, então só vale quando ela não
+// importa (transparência independente de ordem). Sem reuseSlots, add()
+// acrescenta no fim do balde.
+//
+// Um balde cheio cresce em dobro: se é o último do buffer, no lugar; senão
+// muda para o fim e a faixa antiga vira sobra. Quando sobras e buracos passam
+// de compactThreshold dos slots, compactStep() (uma vez por quadro) desliza
+// os baldes para a frente, alguns por chamada (até compactBudget slots),
+// preservando a ordem. Ids continuam válidos; só o slot muda (find()).
+//
+// A ordem de desenho é a dos baldes no buffer e, dentro do balde, a de
+// criação. Entre baldes a ordem de criação (pintor) vem do z de cada vértice:
+// com GL_DEPTH_TEST e glDepthFunc(GL_LEQUAL) o triângulo mais novo fica por
+// cima, desenhado antes ou depois. pick() segue a mesma regra.
+//
+// O z não sai do id, que nunca volta a zero, e sim do rank: a posição do
+// triângulo entre os vivos, na ordem dos ids. Um add() com id maior que todos
+// os anteriores ganha o próximo rank. Quando os ranks acabam, ou quando chega
+// um id fora de ordem (um snapshot sendo carregado), o próximo upload()
+// renumera os vivos de 0 em diante e reenvia o buffer inteiro. Assim a ordem
+// vale para qualquer número de ids, desde que os vivos caibam em
+// SLOT_DEPTH_RANKS.
+class TriangleSlots
+{
+public:
+    static constexpr uint32_t DEAD = 0xFFFFFFFFu;
+
+    bool reuseSlots = false;
+    float compactThreshold = 0.25f; // fração de sobras e buracos que dispara a compactação
+    size_t compactMinHoles = 1024;
+    size_t compactBudget = 16384;   // slots percorridos por compactStep() (ao menos um balde)
+    float cellSize = 256.0f;        // lado do balde, em unidades do mundo
+
+    void init() { glGenBuffers(1, &vbo); }
+    GLuint buffer() const { return vbo; }
+
+    size_t slots() const { return ids.size(); }
+    size_t live() const { return liveCount; }
+    size_t holes() const { return ids.size() - allocated + holeCount; } // sem contar a folga dos baldes
+    bool compacting() const { return compactingNow; }
+    size_t bucketCount() const { return order.size(); }
+
+    bool alive(size_t s) const { return ids[s] != DEAD; }
+    uint32_t id(size_t s) const { return ids[s]; }
+    const SlotVertex *vertices(size_t s) const { return &verts[3 * s]; }
+    uint32_t color(size_t s) const { return verts[3 * s].color; }
+
+    // Slot do triângulo com este id, ou -1
+    long find(uint32_t triangleId) const
+    {
+        if (triangleId >= slotOf.size() || slotOf[triangleId] == DEAD)
+            return -1;
+        return static_cast<long>(slotOf[triangleId]);
+    }
+
+    void reserve(size_t n)
+    {
+        verts.reserve(3 * n);
+        ids.reserve(n);
+        owner.reserve(n);
+        slotOf.reserve(n);
+    }
+
+    // xy: 3 vértices (x, y) no mundo; devolve o slot
+    size_t add(uint32_t triangleId, const float *xy, uint32_t color)
+    {
+        float cx = (xy[0] + xy[2] + xy[4]) / 3.0f, cy = (xy[1] + xy[3] + xy[5]) / 3.0f;
+        uint32_t b = bucketAt(static_cast<int32_t>(std::floor(cx / cellSize)),
+                              static_cast<int32_t>(std::floor(cy / cellSize)));
+        Bucket *k = &buckets[b];
+        size_t s = SIZE_MAX;
+        while (reuseSlots && s == SIZE_MAX && !k->freeSlots.empty())
+        {
+            size_t f = k->freeSlots.back();
+            k->freeSlots.pop_back();
+            if (f >= k->base && f < k->base + k->used && ids[f] == DEAD) // entradas velhas são ignoradas
+            {
+                s = f;
+                --holeCount;
+            }
+        }
+        if (s == SIZE_MAX)
+        {
+            if (k->used == k->capacity)
+                k = grow(b);
+            s = k->base + k->used++;
+        }
+        if (triangleId >= rankedIds)
+            rankedIds = triangleId + 1;
+        else
+            ranksStale = true;
+        // Sem ranks livres, renumerar só compensa se liberar ao menos metade deles
+        if (nextRank >= SLOT_DEPTH_RANKS && liveCount < SLOT_DEPTH_RANKS / 2)
+            ranksStale = true;
+        SlotVertex *v = &verts[3 * s];
+        float z = slotDepth(nextRank++);
+        for (int i = 0; i < 3; ++i)
+            v[i] = {xy[2 * i], xy[2 * i + 1], z, color};
+        ids[s] = triangleId;
+        owner[s] = b;
+        if (triangleId >= slotOf.size())
+            slotOf.resize(std::max<size_t>(static_cast<size_t>(triangleId) + 1, 2 * slotOf.size()), DEAD);
+        slotOf[triangleId] = static_cast<uint32_t>(s);
+        ++liveCount;
+        ++k->live;
+        k->include(xy);
+        markDirty(s, s + 1);
+        return s;
+    }
+
+    void remove(size_t s)
+    {
+        if (!alive(s))
+            return;
+        Bucket &k = buckets[owner[s]];
+        slotOf[ids[s]] = DEAD;
+        ids[s] = DEAD;
+        for (int i = 0; i < 3; ++i)
+            verts[3 * s + i] = {0.0f, 0.0f, 0.0f, 0u};
+        --liveCount;
+        --k.live;
+        ++holeCount;
+        markDirty(s, s + 1);
+        if (reuseSlots)
+            k.freeSlots.push_back(static_cast<uint32_t>(s));
+        // Buracos no fim do balde voltam a ser folga
+        while (k.used > 0 && ids[k.base + k.used - 1] == DEAD)
+        {
+            --k.used;
+            --holeCount;
+        }
+    }
+
+    void setColor(size_t s, uint32_t color)
+    {
+        for (int i = 0; i < 3; ++i)
+            verts[3 * s + i].color = color;
+        markDirty(s, s + 1);
+    }
+
+    // Slot do triângulo de cima (o mais novo, como no desenho) que contém o
+    // ponto, ou -1. Sem reuseSlots cada balde está em ordem de criação e o
+    // primeiro acerto de trás para a frente é o mais novo dele.
+    long pick(float x, float y) const
+    {
+        long best = -1;
+        for (uint32_t b : order)
+        {
+            const Bucket &k = buckets[b];
+            if (k.live == 0 || x < k.bounds[0] || y < k.bounds[1] || x > k.bounds[2] || y > k.bounds[3])
+                continue;
+            for (size_t s = k.base + k.used; s-- > k.base;)
+            {
+                if (ids[s] == DEAD || (best >= 0 && ids[s] < ids[best]))
+                    continue;
+                const SlotVertex *t = &verts[3 * s];
+                float d0 = (t[1].x - t[0].x) * (y - t[0].y) - (t[1].y - t[0].y) * (x - t[0].x);
+                float d1 = (t[2].x - t[1].x) * (y - t[1].y) - (t[2].y - t[1].y) * (x - t[1].x);
+                float d2 = (t[0].x - t[2].x) * (y - t[2].y) - (t[0].y - t[2].y) * (x - t[2].x);
+                if ((d0 >= 0 && d1 >= 0 && d2 >= 0) || (d0 <= 0 && d1 <= 0 && d2 <= 0))
+                {
+                    best = static_cast<long>(s);
+                    if (!reuseSlots)
+                        break;
+                }
+            }
+        }
+        return best;
+    }
+
+    // Faixas de vértices (para glMultiDrawArrays) dos baldes que tocam o
+    // retângulo do mundo; baldes vizinhos no buffer viram uma faixa só.
+    // Devolve quantos baldes entraram.
+    size_t visibleRanges(float minX, float minY, float maxX, float maxY, std::vector<GLint> &first,
+                         std::vector<GLsizei> &count) const
+    {
+        first.clear();
+        count.clear();
+        size_t visible = 0, end = SIZE_MAX;
+        for (uint32_t b : order)
+        {
+            const Bucket &k = buckets[b];
+            if (k.used == 0 || k.bounds[2] < minX || k.bounds[3] < minY || k.bounds[0] > maxX || k.bounds[1] > maxY)
+                continue;
+            ++visible;
+            if (k.base == end)
+                count.back() += static_cast<GLsizei>(3 * k.used);
+            else
+            {
+                first.push_back(static_cast<GLint>(3 * k.base));
+                count.push_back(static_cast<GLsizei>(3 * k.used));
+            }
+            end = k.base + k.used;
+        }
+        return visible;
+    }
+
+    // Alguns baldes da compactação, se sobras e buracos passaram do limite
+    void compactStep()
+    {
+        if (!compactingNow)
+        {
+            if (holes() < compactMinHoles || holes() < compactThreshold * ids.size())
+                return;
+            compactingNow = true;
+            cursor = 0;
+            writeCursor = 0;
+        }
+        size_t moved = 0;
+        while (cursor < order.size() && moved < compactBudget)
+        {
+            Bucket &k = buckets[order[cursor]];
+            size_t oldBase = k.base, oldEnd = k.base + k.used, w = writeCursor;
+            holeCount -= k.used - k.live;
+            allocated -= k.capacity;
+            moved += k.used;
+            k.freeSlots.clear();
+            if (k.live == 0)
+            {
+                // Balde vazio sai da ordem; volta no fim se ganhar triângulos
+                for (size_t r = oldBase; r < oldEnd; ++r)
+                    ids[r] = DEAD;
+                k.capacity = k.used = 0;
+                order.erase(order.begin() + cursor);
+                continue;
+            }
+
+            // writeCursor <= oldBase: copiar em ordem crescente nunca pisa no que falta ler
+            k.bounds[0] = k.bounds[1] = INFINITY;
+            k.bounds[2] = k.bounds[3] = -INFINITY;
+            for (size_t r = oldBase; r < oldEnd; ++r)
+            {
+                if (ids[r] == DEAD)
+                    continue;
+                if (r != w)
+                {
+                    std::memcpy(&verts[3 * w], &verts[3 * r], 3 * sizeof(SlotVertex));
+                    ids[w] = ids[r];
+                    owner[w] = owner[r];
+                    slotOf[ids[w]] = static_cast<uint32_t>(w);
+                }
+                const SlotVertex *v = &verts[3 * w];
+                const float xy[6] = {v[0].x, v[0].y, v[1].x, v[1].y, v[2].x, v[2].y};
+                k.include(xy);
+                ++w;
+            }
+            for (size_t r = std::max(w, oldBase); r < oldEnd; ++r)
+                ids[r] = DEAD;
+
+            // Folga até a faixa antiga do próximo balde (que ainda não andou)
+            size_t limit = cursor + 1 < order.size() ? buckets[order[cursor + 1]].base : ids.size();
+            k.base = writeCursor;
+            k.used = k.live;
+            k.capacity = std::min(k.live + std::max<size_t>(k.live / 2, 16), limit - writeCursor);
+            allocated += k.capacity;
+            if (w > writeCursor && (w != oldEnd || writeCursor != oldBase))
+                markDirty(writeCursor, w);
+            writeCursor += k.capacity;
+            ++cursor;
+        }
+        if (cursor == order.size())
+        {
+            verts.resize(3 * writeCursor);
+            ids.resize(writeCursor, DEAD);
+            owner.resize(writeCursor);
+            compactingNow = false;
+            ++compactions;
+        }
+    }
+
+    // Sobe as faixas alteradas (buffer ligado em GL_ARRAY_BUFFER ao voltar);
+    // devolve os bytes enviados
+    size_t upload()
+    {
+        if (ranksStale)
+            renumber();
+        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        const size_t slotBytes = 3 * sizeof(SlotVertex);
+        size_t sent = 0;
+        if (ids.size() > capacity)
+        {
+            // Cresce em dobro: realocar é raro e manda tudo de uma vez
+            capacity = std::max<size_t>({ids.size(), 2 * capacity, 1024});
+            glBufferData(GL_ARRAY_BUFFER, capacity * slotBytes, nullptr, GL_DYNAMIC_DRAW);
+            if (!ids.empty())
+                glBufferSubData(GL_ARRAY_BUFFER, 0, ids.size() * slotBytes, verts.data());
+            sent = ids.size() * slotBytes;
+            dirty.clear();
+        }
+        if (dirty.empty())
+            return sent;
+
+        // Junta faixas próximas; cada uma é um glBufferSubData pequeno, e só com
+        // milhares delas vale mais mandar uma faixa só do começo ao fim
+        std::sort(dirty.begin(), dirty.end());
+        std::vector<std::pair<size_t, size_t>> runs;
+        for (const auto &d : dirty)
+        {
+            if (!runs.empty() && d.first <= runs.back().second + 2)
+                runs.back().second = std::max(runs.back().second, d.second);
+            else
+                runs.push_back(d);
+        }
+        if (runs.size() > 4096)
+            runs = {{runs.front().first, runs.back().second}};
+        for (auto &run : runs)
+        {
+            size_t end = std::min(run.second, ids.size());
+            if (run.first >= end)
+                continue;
+            glBufferSubData(GL_ARRAY_BUFFER, run.first * slotBytes, (end - run.first) * slotBytes,
+                            &verts[3 * run.first]);
+            sent += (end - run.first) * slotBytes;
+        }
+        dirty.clear();
+        return sent;
+    }
+
+    uint64_t compactionCount() const { return compactions; }
+    uint64_t renumberCount() const { return renumbers; }
+
+    void release()
+    {
+        if (vbo)
+            glDeleteBuffers(1, &vbo);
+        vbo = 0;
+        capacity = 0;
+    }
+
+private:
+    struct Bucket
+    {
+        size_t base = 0, capacity = 0;
+        size_t used = 0; // slots em uso a partir de base (vivos e buracos)
+        size_t live = 0;
+        float bounds[4] = {INFINITY, INFINITY, -INFINITY, -INFINITY}; // x0, y0, x1, y1
+        std::vector<uint32_t> freeSlots;
+
+        void include(const float *xy)
+        {
+            for (int i = 0; i < 3; ++i)
+            {
+                bounds[0] = std::min(bounds[0], xy[2 * i]);
+                bounds[1] = std::min(bounds[1], xy[2 * i + 1]);
+                bounds[2] = std::max(bounds[2], xy[2 * i]);
+                bounds[3] = std::max(bounds[3], xy[2 * i + 1]);
+            }
+        }
+    };
+
+    uint32_t bucketAt(int32_t cx, int32_t cy)
+    {
+        uint64_t key = (static_cast<uint64_t>(static_cast<uint32_t>(cx)) << 32) | static_cast<uint32_t>(cy);
+        auto it = cells.find(key);
+        if (it != cells.end())
+            return it->second;
+        uint32_t b = static_cast<uint32_t>(buckets.size());
+        buckets.emplace_back();
+        cells.emplace(key, b);
+        return b;
+    }
+
+    // Balde cheio: dobra no lugar se for o último do buffer, senão muda para o
+    // fim. Balde sem espaço nenhum (novo ou esvaziado) entra no fim da ordem.
+    Bucket *grow(uint32_t b)
+    {
+        Bucket &k = buckets[b];
+        size_t newCapacity = std::max<size_t>(2 * k.capacity, 16);
+        if (k.capacity == 0)
+        {
+            k.base = ids.size();
+            k.bounds[0] = k.bounds[1] = INFINITY;
+            k.bounds[2] = k.bounds[3] = -INFINITY;
+            resizeSlots(k.base + newCapacity);
+            order.push_back(b);
+        }
+        else if (k.base + k.capacity == ids.size())
+        {
+            resizeSlots(k.base + newCapacity);
+        }
+        else
+        {
+            size_t newBase = ids.size();
+            resizeSlots(newBase + newCapacity);
+            std::memcpy(&verts[3 * newBase], &verts[3 * k.base], 3 * k.used * sizeof(SlotVertex));
+            for (size_t i = 0; i < k.used; ++i)
+            {
+                uint32_t triangleId = ids[k.base + i];
+                ids[newBase + i] = triangleId;
+                owner[newBase + i] = b;
+                if (triangleId != DEAD)
+                    slotOf[triangleId] = static_cast<uint32_t>(newBase + i);
+                ids[k.base + i] = DEAD; // a faixa antiga sai do desenho; a GPU não precisa saber
+            }
+            for (uint32_t &f : k.freeSlots)
+                f += static_cast<uint32_t>(newBase - k.base);
+            k.base = newBase;
+            markDirty(newBase, newBase + k.used);
+
+            // Muda de lugar na ordem; a compactação em andamento não pode pular ninguém
+            size_t pos = std::find(order.begin(), order.end(), b) - order.begin();
+            order.erase(order.begin() + pos);
+            order.push_back(b);
+            if (compactingNow && pos < cursor)
+                --cursor;
+        }
+        allocated += newCapacity - k.capacity;
+        k.capacity = newCapacity;
+        return &k;
+    }
+
+    void resizeSlots(size_t n)
+    {
+        verts.resize(3 * n, SlotVertex{0.0f, 0.0f, 0.0f, 0u});
+        ids.resize(n, DEAD);
+        owner.resize(n, 0);
+    }
+
+    // Ranks 0, 1, 2... para os vivos, na ordem dos ids (slotOf é indexado pelo id)
+    void renumber()
+    {
+        uint32_t rank = 0;
+        for (uint32_t s : slotOf)
+        {
+            if (s == DEAD)
+                continue;
+            float z = slotDepth(rank++);
+            for (int i = 0; i < 3; ++i)
+                verts[3 * s + i].z = z;
+        }
+        nextRank = rank;
+        ranksStale = false;
+        ++renumbers;
+        dirty.clear();
+        markDirty(0, ids.size());
+    }
+
+    void markDirty(size_t begin, size_t end)
+    {
+        if (!dirty.empty() && dirty.back().second == begin)
+            dirty.back().second = end; // o caso comum: adds seguidos no mesmo balde
+        else
+            dirty.emplace_back(begin, end);
+    }
+
+    std::vector<SlotVertex> verts;
+    std::vector<uint32_t> ids;    // id de cada slot; DEAD em buracos, folgas e sobras
+    std::vector<uint32_t> owner;  // balde de cada slot vivo
+    std::vector<uint32_t> slotOf; // slot de cada id (os ids são sequenciais)
+    std::vector<Bucket> buckets;
+    std::vector<uint32_t> order;  // baldes com espaço, na ordem do buffer
+    std::unordered_map<uint64_t, uint32_t> cells;
+    std::vector<std::pair<size_t, size_t>> dirty;
+    size_t liveCount = 0, holeCount = 0, allocated = 0;
+    uint32_t nextRank = 0, rankedIds = 0; // rankedIds: maior id já visto + 1
+    bool ranksStale = false;
+    uint64_t renumbers = 0;
+    bool compactingNow = false;
+    size_t cursor = 0, writeCursor = 0;
+    uint64_t compactions = 0;
+    GLuint vbo = 0;
+    size_t capacity = 0; // em slots
+};
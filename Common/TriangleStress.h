@@ -0,0 +1,215 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "Color.h"
+#include "Random.h"
+#include "SceneJournal.h"
+
+// Gerador de carga para o editor de triângulos (Lista2/Exercicio6): injeta
+// triângulos aleatórios a uma taxa fixa, sempre a mesma sequência para a
+// mesma semente. Os números saem do Xoshiro128x8 em blocos (14 floats por
+// triângulo) e viram SceneRecord, o formato que o editor e o diário já usam.
+//
+// Variáveis (todas opcionais, exceto uma das duas primeiras):
+//   FCG_STRESS=n            triângulos por segundo
+//   FCG_STRESS_PER_FRAME=n  n por quadro, independente do relógio (reproduzível
+//                           também na regressão)
+//   FCG_STRESS_SEED=s       semente (padrão 1)
+//   FCG_STRESS_SPATIAL      uniform | gauss | clusters  (padrão uniform)
+//   FCG_STRESS_SIZE=px      tamanho médio (padrão 12)
+//   FCG_STRESS_SIZE_DIST    fixed | uniform | exp  (padrão uniform)
+//   FCG_STRESS_MAX=n        para de gerar com n triângulos na cena (padrão 2000000)
+//   FCG_STRESS_DELETE=f     apaga f triângulos sorteados para cada novo (padrão 0;
+//                           com 1 a cena fica do mesmo tamanho e só gira); o
+//                           sorteio também vem da semente
+//   FCG_STRESS_CANVAS=WxH   área do mundo a preencher (padrão: a janela); maior
+//                           que a janela, exercita o recorte por baldes e o zoom
+
+enum class StressSpatial
+{
+    Uniform,  // janela inteira
+    Gauss,    // normal em torno do centro
+    Clusters  // normais pequenas em torno de 8 centros fixos
+};
+
+enum class StressSize
+{
+    Fixed,
+    Uniform,    // entre 0,5 e 1,5 vezes o tamanho
+    Exponential // muitos pequenos e alguns grandes (cortado em 8 vezes)
+};
+
+struct StressConfig
+{
+    double rate = 0.0;
+    size_t perFrame = 0;
+    uint64_t seed = 1;
+    StressSpatial spatial = StressSpatial::Uniform;
+    StressSize sizeDist = StressSize::Uniform;
+    float size = 12.0f;
+    size_t maxTriangles = 2000000;
+    double deleteRatio = 0.0;
+    float canvasWidth = 0.0f, canvasHeight = 0.0f; // 0: tamanho da janela
+
+    bool enabled() const { return rate > 0.0 || perFrame > 0; }
+};
+
+inline StressConfig stressConfigFromEnv()
+{
+    StressConfig c;
+    auto env = [](const char *name) { const char *v = getenv(name); return v && *v ? v : nullptr; };
+    if (const char *v = env("FCG_STRESS"))
+        c.rate = atof(v);
+    if (const char *v = env("FCG_STRESS_PER_FRAME"))
+        c.perFrame = static_cast<size_t>(atol(v));
+    if (const char *v = env("FCG_STRESS_SEED"))
+        c.seed = strtoull(v, nullptr, 10);
+    if (const char *v = env("FCG_STRESS_SPATIAL"))
+        c.spatial = strcmp(v, "gauss") == 0 ? StressSpatial::Gauss
+                    : strcmp(v, "clusters") == 0 ? StressSpatial::Clusters
+                                                 : StressSpatial::Uniform;
+    if (const char *v = env("FCG_STRESS_SIZE"))
+        c.size = static_cast<float>(atof(v));
+    if (const char *v = env("FCG_STRESS_SIZE_DIST"))
+        c.sizeDist = strcmp(v, "fixed") == 0 ? StressSize::Fixed
+                     : strcmp(v, "exp") == 0 ? StressSize::Exponential
+                                             : StressSize::Uniform;
+    if (const char *v = env("FCG_STRESS_MAX"))
+        c.maxTriangles = static_cast<size_t>(atol(v));
+    if (const char *v = env("FCG_STRESS_DELETE"))
+        c.deleteRatio = atof(v);
+    if (const char *v = env("FCG_STRESS_CANVAS"))
+        if (std::sscanf(v, "%fx%f", &c.canvasWidth, &c.canvasHeight) != 2)
+            c.canvasWidth = c.canvasHeight = 0.0f;
+    return c;
+}
+
+class TriangleStress
+{
+public:
+    static const int FLOATS_PER_TRIANGLE = 14; // posição 3, tamanho 1, vértices 6, cor 4
+
+    void init(const StressConfig &config)
+    {
+        cfg = config;
+        rng.reseed(cfg.seed);
+        victims.reseed(cfg.seed ^ 0xDE1u);
+        Xoshiro128 centers(cfg.seed ^ 0xC1u);
+        for (float &c : clusterXY)
+            c = centers.uniform(0.1f, 0.9f);
+        carry = deleteCarry = 0.0;
+        total = 0;
+    }
+
+    const StressConfig &config() const { return cfg; }
+    bool enabled() const { return cfg.enabled(); }
+    uint64_t generated() const { return total; }
+
+    // Quantos triângulos este quadro deve gerar, com `current` já na cena
+    size_t due(double dtSeconds, size_t current)
+    {
+        if (!cfg.enabled() || current >= cfg.maxTriangles)
+            return 0;
+        size_t n = cfg.perFrame;
+        if (n == 0)
+        {
+            carry += cfg.rate * std::min(dtSeconds, 0.25); // uma pausa longa não vira uma rajada
+            n = static_cast<size_t>(carry);
+            carry -= static_cast<double>(n);
+        }
+        return std::min(n, cfg.maxTriangles - current);
+    }
+
+    // Quantos apagar depois de gerar `added`
+    size_t deletions(size_t added)
+    {
+        deleteCarry += cfg.deleteRatio * static_cast<double>(added);
+        size_t n = static_cast<size_t>(deleteCarry);
+        deleteCarry -= static_cast<double>(n);
+        return n;
+    }
+
+    // Slot a apagar, entre 0 e slots - 1. Sai de uma sequência própria da mesma
+    // semente, então as remoções se repetem junto com os triângulos gerados
+    size_t victim(size_t slots)
+    {
+        return static_cast<size_t>(victims.next()) % slots;
+    }
+
+    // n triângulos numa área de width x height pixels, ids a partir de firstId e
+    // alpha entre alphaLo e alphaHi
+    void generate(SceneRecord *out, size_t n, float width, float height, uint32_t firstId,
+                  float alphaLo = 1.0f, float alphaHi = 1.0f)
+    {
+        const size_t chunk = 1024;
+        const float twoPi = 6.28318530718f;
+        float spread = std::min(width, height);
+        scratch.resize(chunk * FLOATS_PER_TRIANGLE);
+        for (size_t done = 0; done < n; done += chunk)
+        {
+            size_t count = std::min(chunk, n - done);
+            rng.fill(scratch.data(), count * FLOATS_PER_TRIANGLE);
+            for (size_t i = 0; i < count; ++i)
+            {
+                const float *u = &scratch[i * FLOATS_PER_TRIANGLE];
+                float cx, cy;
+                if (cfg.spatial == StressSpatial::Uniform)
+                {
+                    cx = u[0] * width;
+                    cy = u[1] * height;
+                }
+                else
+                {
+                    // Box-Muller: 1 - u[0] fica em (0, 1], o log não explode
+                    float r = std::sqrt(-2.0f * std::log(1.0f - u[0]));
+                    float dx = r * std::cos(twoPi * u[1]), dy = r * std::sin(twoPi * u[1]);
+                    if (cfg.spatial == StressSpatial::Gauss)
+                    {
+                        cx = 0.5f * width + 0.15f * spread * dx;
+                        cy = 0.5f * height + 0.15f * spread * dy;
+                    }
+                    else
+                    {
+                        int k = std::min(static_cast<int>(u[2] * CLUSTERS), CLUSTERS - 1);
+                        cx = clusterXY[2 * k] * width + 0.03f * spread * dx;
+                        cy = clusterXY[2 * k + 1] * height + 0.03f * spread * dy;
+                    }
+                }
+                float s = cfg.size;
+                if (cfg.sizeDist == StressSize::Uniform)
+                    s *= 0.5f + u[3];
+                else if (cfg.sizeDist == StressSize::Exponential)
+                    s *= std::min(-std::log(1.0f - u[3]), 8.0f);
+
+                SceneRecord &r = out[done + i];
+                r.id = firstId + static_cast<uint32_t>(done + i);
+                for (int v = 0; v < 3; ++v)
+                {
+                    r.xy[2 * v] = cx + s * (2.0f * u[4 + 2 * v] - 1.0f);
+                    r.xy[2 * v + 1] = cy + s * (2.0f * u[5 + 2 * v] - 1.0f);
+                }
+                r.color = canvasColor(0.2f + 0.8f * u[10], 0.2f + 0.8f * u[11], 0.2f + 0.8f * u[12],
+                                      alphaLo + (alphaHi - alphaLo) * u[13]);
+            }
+        }
+        total += n;
+    }
+
+private:
+    static const int CLUSTERS = 8;
+
+    StressConfig cfg;
+    Xoshiro128x8 rng;
+    Xoshiro128 victims;
+    float clusterXY[2 * CLUSTERS] = {};
+    std::vector<float> scratch;
+    double carry = 0.0, deleteCarry = 0.0;
+    uint64_t total = 0;
+};
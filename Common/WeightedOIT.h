@@ -0,0 +1,187 @@
+#pragma once
+
+#include <iostream>
+
+#include <glad/glad.h>
+
+#include "ShaderDefines.h"
+#include "ShaderProgram.h"
+
+// Transparência independente de ordem por média ponderada (McGuire e Bavoil,
+// 2013). Os triângulos transparentes são desenhados em qualquer ordem num FBO
+// com dois alvos:
+//   0: soma de (rgb*a, a) * peso   (RGBA16F, mistura ONE, ONE)
+//   1: produto de (1 - a)          (R16F, mistura ZERO, ONE_MINUS_SRC_COLOR)
+// e uma passada de composição mistura a média sobre o que já estava na tela.
+// O custo não depende da ordem nem exige ordenar na CPU.
+//
+//   WeightedOIT oit;
+//   GLuint prog = oit.init(vsSrc);          // VS do exercício + FS de acumulação
+//   (oit.init(vsSrc, true): cor do "out vec4 vColor" do VS em vez do uniform)
+//   oit.begin(w, h);  ...draws com prog...  oit.end();
+//
+// O peso usa a opacidade e gl_FragCoord.z; numa cena 2D com z constante só a
+// opacidade conta.
+class WeightedOIT
+{
+public:
+    // Devolve o programa de acumulação (uniform vec4 inputColor, como os exercícios)
+    GLuint init(const GLchar *vertexSrc, bool vertexColor = false)
+    {
+        accumProgram = linkProgram(vertexSrc, glslWithDefine(accumFragmentSrc, vertexColor ? "VERTEX_COLOR" : nullptr).c_str(), "WeightedOIT");
+        compositeProgram = linkProgram(compositeVertexSrc, compositeFragmentSrc, "WeightedOIT");
+        glUseProgram(compositeProgram);
+        glUniform1i(glGetUniformLocation(compositeProgram, "accumTex"), 0);
+        glUniform1i(glGetUniformLocation(compositeProgram, "revealTex"), 1);
+        glUseProgram(0);
+        glGenVertexArrays(1, &emptyVao);
+        return accumProgram;
+    }
+
+    GLuint program() const { return accumProgram; }
+
+    void begin(int w, int h)
+    {
+        glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &target);
+        saveBlend();
+        ensureTargets(w, h);
+        glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+        const GLfloat zero[] = {0.0f, 0.0f, 0.0f, 0.0f};
+        const GLfloat one[] = {1.0f, 1.0f, 1.0f, 1.0f};
+        glClearBufferfv(GL_COLOR, 0, zero);
+        glClearBufferfv(GL_COLOR, 1, one);
+        glEnable(GL_BLEND);
+        glBlendFunci(0, GL_ONE, GL_ONE);
+        glBlendFunci(1, GL_ZERO, GL_ONE_MINUS_SRC_COLOR);
+    }
+
+    // Compõe sobre o framebuffer que estava ligado em begin() (a janela ou o FBO
+    // do MSAA) e devolve o blend como estava antes de begin()
+    void end()
+    {
+        glBindFramebuffer(GL_FRAMEBUFFER, target);
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        GLint previous;
+        glGetIntegerv(GL_CURRENT_PROGRAM, &previous);
+        glUseProgram(compositeProgram);
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, accumTex);
+        glActiveTexture(GL_TEXTURE1);
+        glBindTexture(GL_TEXTURE_2D, revealTex);
+        glActiveTexture(GL_TEXTURE0);
+        glBindVertexArray(emptyVao);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+        glBindVertexArray(0);
+        glUseProgram(previous);
+        glBlendFuncSeparate(savedBlend[0], savedBlend[1], savedBlend[2], savedBlend[3]);
+        if (!blendWasEnabled)
+            glDisable(GL_BLEND);
+    }
+
+    void release()
+    {
+        glDeleteProgram(accumProgram);
+        glDeleteProgram(compositeProgram);
+        glDeleteVertexArrays(1, &emptyVao);
+        glDeleteFramebuffers(1, &fbo);
+        glDeleteTextures(1, &accumTex);
+        glDeleteTextures(1, &revealTex);
+        accumProgram = compositeProgram = emptyVao = fbo = accumTex = revealTex = 0;
+    }
+
+private:
+    void saveBlend()
+    {
+        blendWasEnabled = glIsEnabled(GL_BLEND);
+        glGetIntegerv(GL_BLEND_SRC_RGB, &savedBlend[0]);
+        glGetIntegerv(GL_BLEND_DST_RGB, &savedBlend[1]);
+        glGetIntegerv(GL_BLEND_SRC_ALPHA, &savedBlend[2]);
+        glGetIntegerv(GL_BLEND_DST_ALPHA, &savedBlend[3]);
+    }
+
+    void ensureTargets(int w, int h)
+    {
+        if (fbo && w == width && h == height)
+            return;
+        if (!fbo)
+        {
+            glGenFramebuffers(1, &fbo);
+            glGenTextures(1, &accumTex);
+            glGenTextures(1, &revealTex);
+        }
+        width = w;
+        height = h;
+        allocate(accumTex, GL_RGBA16F, GL_RGBA);
+        allocate(revealTex, GL_R16F, GL_RED);
+        glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, accumTex, 0);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT1, GL_TEXTURE_2D, revealTex, 0);
+        const GLenum buffers[] = {GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1};
+        glDrawBuffers(2, buffers);
+        if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+            std::cerr << "WeightedOIT: FBO incompleto" << std::endl;
+        glBindFramebuffer(GL_FRAMEBUFFER, target);
+    }
+
+    void allocate(GLuint tex, GLint internalFormat, GLenum format)
+    {
+        glBindTexture(GL_TEXTURE_2D, tex);
+        glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, format, GL_FLOAT, NULL);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glBindTexture(GL_TEXTURE_2D, 0);
+    }
+
+    // Peso da equação (10) do artigo, limitado para caber em half float
+    static constexpr const GLchar *accumFragmentSrc = R"(
+ #version 400
+ #ifdef VERTEX_COLOR
+ in vec4 vColor;
+ #define inputColor vColor
+ #else
+ uniform vec4 inputColor;
+ #endif
+ layout (location = 0) out vec4 accum;
+ layout (location = 1) out vec4 reveal;
+ void main()
+ {
+	 float a = inputColor.a;
+	 float w = clamp(pow(min(1.0, a * 10.0) + 0.01, 3.0) * 1e8 * pow(1.0 - gl_FragCoord.z * 0.9, 3.0), 1e-2, 3e3);
+	 accum = vec4(inputColor.rgb * a, a) * w;
+	 reveal = vec4(a);
+ }
+ )";
+
+    // Triângulo que cobre a tela, sem VBO
+    static constexpr const GLchar *compositeVertexSrc = R"(
+ #version 400
+ void main()
+ {
+	 vec2 p = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+	 gl_Position = vec4(p * 2.0 - 1.0, 0.0, 1.0);
+ }
+ )";
+
+    static constexpr const GLchar *compositeFragmentSrc = R"(
+ #version 400
+ uniform sampler2D accumTex;
+ uniform sampler2D revealTex;
+ out vec4 color;
+ void main()
+ {
+	 ivec2 p = ivec2(gl_FragCoord.xy);
+	 float reveal = texelFetch(revealTex, p, 0).r;
+	 if (reveal >= 0.9999)
+		 discard;
+	 vec4 accum = texelFetch(accumTex, p, 0);
+	 color = vec4(accum.rgb / max(accum.a, 1e-5), 1.0 - reveal);
+ }
+ )";
+
+    GLuint accumProgram = 0, compositeProgram = 0, emptyVao = 0;
+    GLuint fbo = 0, accumTex = 0, revealTex = 0;
+    GLint target = 0;
+    GLint savedBlend[4] = {GL_ONE, GL_ZERO, GL_ONE, GL_ZERO}; // src/dst rgb, src/dst alpha
+    GLboolean blendWasEnabled = GL_FALSE;
+    int width = 0, height = 0;
+};
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include "GLLoader.h"
+
+// Várias janelas num processo só, com contextos que compartilham objetos. A
+// primeira janela cria o contexto dono e carrega o OpenGL; as seguintes passam
+// essa janela como `share` para o glfwCreateWindow, então programas, buffers e
+// texturas criados em qualquer uma valem em todas. VAOs (e FBOs) não são
+// compartilhados pelo OpenGL: cada contexto tem os seus, criados sob demanda
+// por vertexArray().
+//
+//   WindowGroup group;
+//   group.open("A", 400, 400);  ...programas e VBOs...
+//   group.open("B", 400, 400);
+//   while (group.running()) {
+//       glfwPollEvents();
+//       for (size_t i = 0; i < group.size(); ++i) {
+//           if (!group.begin(i)) continue;       // contexto de i atual
+//           glBindVertexArray(group.vertexArray(i, 0, [&] { ...glVertexAttribPointer... }));
+//           ...
+//           glfwSwapBuffers(group.window(i));
+//       }
+//   }
+//   group.release();
+//
+// Os ponteiros da GLAD são globais e carregados uma vez: todos os contextos
+// são do mesmo driver e com o mesmo formato, então os endereços valem para
+// todos. Só a primeira janela espera o vsync; as outras trocam com intervalo 0
+// para o laço não esperar um retraço por janela.
+class WindowGroup
+{
+public:
+    // nullptr se a janela não pôde ser criada (ou o OpenGL não carregou na primeira)
+    GLFWwindow *open(const char *title, int width, int height)
+    {
+        auto start = std::chrono::steady_clock::now();
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
+        glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+        GLFWwindow *share = windows.empty() ? nullptr : windows[0];
+        GLFWwindow *win = glfwCreateWindow(width, height, title, nullptr, share);
+        if (!win)
+        {
+            std::cerr << "WindowGroup: falha ao criar a janela " << title << std::endl;
+            return nullptr;
+        }
+        glfwMakeContextCurrent(win);
+        if (!share && !loadGL((GLADloadproc)glfwGetProcAddress))
+        {
+            std::cerr << "WindowGroup: falha ao carregar o OpenGL" << std::endl;
+            glfwDestroyWindow(win);
+            return nullptr;
+        }
+        glfwSwapInterval(share ? 0 : 1);
+        windows.push_back(win);
+        openTimes.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+        return win;
+    }
+
+    size_t size() const { return windows.size(); }
+    GLFWwindow *window(size_t i) const { return windows[i]; }
+
+    // Tempo de glfwCreateWindow + contexto (+ carregador, na primeira), em ms
+    double openMs(size_t i) const { return openTimes[i]; }
+
+    // Torna o contexto de i atual; false se a janela foi fechada (ela é só
+    // escondida, para o contexto dono continuar vivo)
+    bool begin(size_t i)
+    {
+        GLFWwindow *win = windows[i];
+        if (glfwWindowShouldClose(win))
+        {
+            if (glfwGetWindowAttrib(win, GLFW_VISIBLE))
+                glfwHideWindow(win);
+            return false;
+        }
+        if (glfwGetCurrentContext() != win)
+            glfwMakeContextCurrent(win);
+        return true;
+    }
+
+    // Fechar a primeira janela encerra o grupo; as outras podem fechar antes
+    bool running() const { return !windows.empty() && !glfwWindowShouldClose(windows[0]); }
+
+    // VAO da chave `key` no contexto da janela i, criado na primeira vez com
+    // build() (o VAO já vem ligado; build só configura os atributos). O
+    // contexto de i precisa estar atual.
+    template <class Build>
+    GLuint vertexArray(size_t i, int key, Build build)
+    {
+        auto it = vaos.find({i, key});
+        if (it != vaos.end())
+            return it->second;
+        GLuint vao;
+        glGenVertexArrays(1, &vao);
+        glBindVertexArray(vao);
+        build();
+        glBindVertexArray(0);
+        vaos[{i, key}] = vao;
+        return vao;
+    }
+
+    // Apaga os VAOs no contexto de cada janela e destrói as janelas (a dona por último)
+    void release()
+    {
+        for (auto &entry : vaos)
+        {
+            glfwMakeContextCurrent(windows[entry.first.first]);
+            glDeleteVertexArrays(1, &entry.second);
+        }
+        vaos.clear();
+        glfwMakeContextCurrent(nullptr);
+        for (size_t i = windows.size(); i-- > 0;)
+            glfwDestroyWindow(windows[i]);
+        windows.clear();
+        openTimes.clear();
+    }
+
+private:
+    std::vector<GLFWwindow *> windows;
+    std::vector<double> openTimes;
+    std::map<std::pair<size_t, int>, GLuint> vaos;
+};
@@ -0,0 +1,10 @@
+#version 400
+layout (location = 0) in vec3 position;
+layout (location = 1) in vec3 color;
+out vec3 vColor;
+uniform mat4 projection;
+void main()
+{
+	gl_Position = projection * vec4(position.x, position.y, position.z, 1.0);
+	vColor = color;
+}
@@ -0,0 +1,291 @@
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Só os tipos da GLAD (GLfloat); nenhuma função OpenGL é chamada aqui (o
+// Canvas referencia os ponteiros da GLAD, que ficam nulos)
+#include <glad/glad.h>
+
+// GLM
+#include <glm/glm.hpp>
+
+using namespace glm;
+
+#include "BenchTimer.h"
+#include "Canvas.h"
+#include "Color.h"
+#include "Geometry.h"
+#include "Path.h"
+#include "Random.h"
+#include "TriangleStress.h"
+
+// Benchmark dos caminhos de CPU que geram e empacotam geometria nos exercícios.
+// Não abre janela nem cria contexto: "upload" aqui é a cópia para a memória de
+// staging que a glBufferData faz antes de a GPU ver os dados.
+//
+// Uso: GeometryBench [saida.json]   (padrão: bench_geometry.json)
+
+// Partes da casa do Exercicio9 (lista 1): 2 triângulos de telhado e 11 retângulos,
+// cada um enviado por makeVAO com seu próprio glBufferData
+static const int houseParts[] = {3, 3, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6};
+
+int main(int argc, char **argv)
+{
+    string outPath = argc > 1 ? argv[1] : "bench_geometry.json";
+    vector<BenchResult> results;
+
+    // Lista 1, Exercicio6: círculo com 100 segmentos (leque)
+    {
+        const int segments = 100;
+        vector<GLfloat> v(segments * 9);
+        results.push_back(benchRun("lista1/circulo_100", [&] {
+            circleFan(v.data(), segments, segments, 0.0f, 0.0f, 0.5f);
+            benchKeep(v.data());
+        }, segments * 3, v.size() * sizeof(GLfloat)));
+    }
+
+    // Lista 1, Exercicio6a/6b: polígonos regulares (octógono e pentágono)
+    for (int segments : {8, 5})
+    {
+        vector<GLfloat> v(segments * 9);
+        results.push_back(benchRun("lista1/poligono_" + to_string(segments), [&] {
+            circleFan(v.data(), segments, segments, 0.0f, 0.0f, 0.5f);
+            benchKeep(v.data());
+        }, segments * 3, v.size() * sizeof(GLfloat)));
+    }
+
+    // Lista 1, Exercicio6c: setor ("pac-man")
+    {
+        const int segments = 100, total = 82;
+        vector<GLfloat> v(total * 9);
+        results.push_back(benchRun("lista1/setor_82_de_100", [&] {
+            circleFan(v.data(), total, segments, 0.0f, 0.0f, 0.5f, M_PI / 5.0f);
+            benchKeep(v.data());
+        }, total * 3, v.size() * sizeof(GLfloat)));
+    }
+
+    // Lista 1, Exercicio6e: estrela
+    {
+        const int segments = 5;
+        vector<GLfloat> v(segments * 18);
+        results.push_back(benchRun("lista1/estrela_5", [&] {
+            starFan(v.data(), segments, 0.0f, 0.0f, 0.5f, 0.18f, 4.08);
+            benchKeep(v.data());
+        }, segments * 6, v.size() * sizeof(GLfloat)));
+    }
+
+    // Lista 1, Exercicio7: espiral com 190 pontos, e uma versão grande para ver a vazão
+    for (int points : {190, 100000})
+    {
+        vector<GLfloat> v(points * 3);
+        results.push_back(benchRun("lista1/espiral_" + to_string(points), [&] {
+            spiral(v.data(), points, 0.0f, 0.0f, 0.0f, 0.02f, 0.1f);
+            benchKeep(v.data());
+        }, points, v.size() * sizeof(GLfloat)));
+    }
+
+    // Círculo grande: custo por vértice sem o peso fixo da chamada
+    {
+        const int segments = 100000;
+        vector<GLfloat> v(segments * 9);
+        results.push_back(benchRun("lista1/circulo_100000", [&] {
+            circleFan(v.data(), segments, segments, 0.0f, 0.0f, 0.5f);
+            benchKeep(v.data());
+        }, segments * 3.0, v.size() * sizeof(GLfloat), 3, 50));
+    }
+
+    // Lista 1, Exercicio9: empacotamento das partes da casa como em makeVAO
+    {
+        vector<vector<GLfloat>> parts;
+        size_t total = 0, vertices = 0;
+        for (int n : houseParts)
+        {
+            parts.emplace_back(n * 3, 0.25f);
+            total += n * 3;
+            vertices += n;
+        }
+        vector<GLfloat> staging(total);
+        results.push_back(benchRun("lista1/casa_makeVAO", [&] {
+            GLfloat *dst = staging.data();
+            for (const vector<GLfloat> &p : parts)
+            {
+                memcpy(dst, p.data(), p.size() * sizeof(GLfloat));
+                dst += p.size();
+            }
+            benchKeep(staging.data());
+        }, vertices, total * sizeof(GLfloat)));
+    }
+
+    // Lista 2, Exercicio6: inserção de triângulos como no mouse_button_callback
+    {
+        const int triangles = 10000;
+        vector<vec3> vertices;
+        vector<vec4> colors;
+        results.push_back(benchRun("lista2/append_10000_random_device", [&] {
+            vertices.clear();
+            colors.clear();
+            for (int t = 0; t < triangles; ++t)
+            {
+                vertices.push_back(vec3(t, 0.0f, 0.0f));
+                vertices.push_back(vec3(t, 1.0f, 0.0f));
+                vertices.push_back(vec3(t, 0.0f, 1.0f));
+                std::random_device rd;
+                std::mt19937 gen(rd());
+                std::uniform_real_distribution<float> dist(0.2f, 1.0f);
+                colors.push_back(vec4(dist(gen), dist(gen), dist(gen), 1.0f));
+            }
+            benchKeep(vertices.data());
+            benchKeep(colors.data());
+        }, triangles * 3.0, triangles * (3 * sizeof(vec3) + sizeof(vec4)), 2, 30));
+
+        // Mesmo append com um gerador só (o custo acima é quase todo do random_device)
+        std::mt19937 gen(1234);
+        std::uniform_real_distribution<float> dist(0.2f, 1.0f);
+        results.push_back(benchRun("lista2/append_10000", [&] {
+            vertices.clear();
+            colors.clear();
+            for (int t = 0; t < triangles; ++t)
+            {
+                vertices.push_back(vec3(t, 0.0f, 0.0f));
+                vertices.push_back(vec3(t, 1.0f, 0.0f));
+                vertices.push_back(vec3(t, 0.0f, 1.0f));
+                colors.push_back(vec4(dist(gen), dist(gen), dist(gen), 1.0f));
+            }
+            benchKeep(vertices.data());
+            benchKeep(colors.data());
+        }, triangles * 3.0, triangles * (3 * sizeof(vec3) + sizeof(vec4))));
+
+        // O loop de render reenvia todos os vértices a cada quadro
+        vector<vec3> staging(vertices.size());
+        results.push_back(benchRun("lista2/reenvio_10000", [&] {
+            memcpy(staging.data(), vertices.data(), vertices.size() * sizeof(vec3));
+            benchKeep(staging.data());
+        }, vertices.size(), vertices.size() * sizeof(vec3)));
+    }
+
+    // Gerador de carga do Exercicio6: números aleatórios em bloco e triângulos prontos
+    {
+        const size_t count = 1 << 20;
+        vector<float> floats(count);
+        std::mt19937 gen(1234);
+        std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+        results.push_back(benchRun("random/mt19937_1M", [&] {
+            for (float &f : floats)
+                f = dist(gen);
+            benchKeep(floats.data());
+        }, count, count * sizeof(float), 2, 30));
+        Xoshiro128x8 lanes(1234);
+        results.push_back(benchRun("random/xoshiro128x8_1M", [&] {
+            lanes.fill(floats.data(), count);
+            benchKeep(floats.data());
+        }, count, count * sizeof(float), 2, 30));
+
+        const size_t triangles = 100000;
+        vector<SceneRecord> records(triangles);
+        for (StressSpatial spatial : {StressSpatial::Uniform, StressSpatial::Clusters})
+        {
+            StressConfig cfg;
+            cfg.perFrame = triangles;
+            cfg.spatial = spatial;
+            TriangleStress stress;
+            stress.init(cfg);
+            results.push_back(benchRun(spatial == StressSpatial::Uniform ? "stress/gera_100000" : "stress/gera_100000_clusters", [&] {
+                stress.generate(records.data(), triangles, 800.0f, 600.0f, 0);
+                benchKeep(records.data());
+            }, triangles, triangles * sizeof(SceneRecord), 2, 30));
+        }
+    }
+
+    // Caminhos: 10000 cúbicas aleatórias achatadas a 1/4 de pixel numa janela de 800x800.
+    // Itens = segmentos gerados, para comparar com a meta de dezenas de milhões por segundo
+    {
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<float> coord(-1.0f, 1.0f);
+        Path path;
+        for (int c = 0; c < 10000; ++c)
+        {
+            path.moveTo(coord(gen), coord(gen));
+            path.cubicTo(coord(gen), coord(gen), coord(gen), coord(gen), coord(gen), coord(gen));
+        }
+        FlatPath flat;
+        CurveBatch batch;
+        flattenPath(path, 0.25f, 400.0f, flat, batch);
+        size_t segments = flat.pointCount() - flat.contourCount();
+        results.push_back(benchRun("path/achata_10000_cubicas", [&] {
+            flattenPath(path, 0.25f, 400.0f, flat, batch);
+            benchKeep(flat.xy.data());
+        }, segments, flat.xy.size() * sizeof(float), 3, 50));
+    }
+
+    // Círculo do Exercicio6 como caminho: achatamento, preenchimento e contorno
+    {
+        Path path;
+        path.arc(0.0f, 0.0f, 0.5f, 0.0f, 2.0f * M_PI);
+        path.close();
+        FlatPath flat;
+        CurveBatch batch;
+        vector<GLfloat> fill, stroke;
+        flattenPath(path, 0.25f, 400.0f, flat, batch);
+        results.push_back(benchRun("path/circulo_achata", [&] {
+            flattenPath(path, 0.25f, 400.0f, flat, batch);
+            benchKeep(flat.xy.data());
+        }, flat.pointCount(), flat.xy.size() * sizeof(float)));
+        results.push_back(benchRun("path/circulo_preenche", [&] {
+            fill.clear();
+            fillTriangles(flat, fill);
+            benchKeep(fill.data());
+        }, flat.pointCount(), flat.pointCount() * 9 * sizeof(GLfloat)));
+        results.push_back(benchRun("path/circulo_contorno", [&] {
+            stroke.clear();
+            strokeTriangles(flat, 0.01f, stroke);
+            benchKeep(stroke.data());
+        }, flat.pointCount(), flat.pointCount() * 18 * sizeof(GLfloat)));
+    }
+
+    // Canvas com 1M primitivas por quadro (metade retângulos, metade triângulos):
+    // chamadas fill* até a arena, mais a cópia que o flush faz para o VBO mapeado.
+    // O lote cabe inteiro na arena, então nada é enviado ao OpenGL
+    {
+        const size_t primitives = 1000000;
+        Xoshiro128 rng(1234);
+        vector<float> xy(primitives * 6);
+        vector<uint32_t> colors(primitives);
+        for (float &f : xy)
+            f = rng.uniform(-1.0f, 1.0f);
+        for (uint32_t &c : colors)
+            c = canvasColor(rng.uniform(0.2f, 1.0f), rng.uniform(0.2f, 1.0f), rng.uniform(0.2f, 1.0f), 1.0f);
+        Canvas canvas;
+        canvas.batchVertices = primitives * 6;
+        vector<CanvasVertex> staging(primitives * 6);
+        results.push_back(benchRun("canvas/1M_primitivas", [&] {
+            canvas.beginFrame(800, 800);
+            for (size_t i = 0; i < primitives; ++i)
+            {
+                const float *p = &xy[6 * i];
+                if (i & 1)
+                    canvas.fillTriangle(p[0], p[1], p[2], p[3], p[4], p[5], colors[i]);
+                else
+                    canvas.fillRect(p[0], p[1], p[0] + 0.01f, p[1] + 0.01f, colors[i]);
+            }
+            const vector<CanvasVertex> &batch = canvas.pending();
+            memcpy(staging.data(), batch.data(), batch.size() * sizeof(CanvasVertex));
+            benchKeep(staging.data());
+            canvas.discardPending();
+        }, primitives, primitives / 2 * 9 * sizeof(CanvasVertex), 2, 30));
+    }
+
+    for (const BenchResult &r : results)
+        benchPrint(r);
+
+    if (!benchWriteJson(outPath, results))
+    {
+        std::cerr << "Falha ao gravar " << outPath << std::endl;
+        return 1;
+    }
+    cout << "Resultados em " << outPath << endl;
+    return 0;
+}
@@ -0,0 +1,124 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include "BenchTimer.h"
+#include "GLLoader.h"
+
+// Tempo até o primeiro quadro com o carregador completo da GLAD e com o
+// carregador mínimo (Common/GLLoader.h). Cada amostra faz o caminho inteiro de
+// um exercício: glfwInit, janela (invisível), carregador, compilação de um
+// shader, um glClear e o primeiro glfwSwapBuffers, e depois desmonta tudo.
+//
+// A carga do driver (dlopen da libGL etc.) só acontece na primeira amostra do
+// processo e fica no aquecimento; os números são do caminho "quente".
+//
+// Uso: StartupBench [saida.json]   (padrão: bench_startup.json)
+
+const GLchar *vsSrc = R"(
+#version 400
+layout (location = 0) in vec3 position;
+void main() { gl_Position = vec4(position, 1.0); }
+)";
+
+const GLchar *fsSrc = R"(
+#version 400
+uniform vec4 inputColor;
+out vec4 color;
+void main() { color = inputColor; }
+)";
+
+static int loadWith(bool full)
+{
+    return full ? gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)
+                : loadGLMinimal((GLADloadproc)glfwGetProcAddress);
+}
+
+static GLFWwindow *openWindow()
+{
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
+    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    GLFWwindow *win = glfwCreateWindow(800, 600, "StartupBench", nullptr, nullptr);
+    if (win)
+        glfwMakeContextCurrent(win);
+    return win;
+}
+
+static bool firstFrame(bool full)
+{
+    if (!glfwInit())
+        return false;
+    GLFWwindow *win = openWindow();
+    if (!win || !loadWith(full))
+    {
+        glfwTerminate();
+        return false;
+    }
+
+    GLuint vs = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(vs, 1, &vsSrc, NULL);
+    glCompileShader(vs);
+    GLuint fs = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(fs, 1, &fsSrc, NULL);
+    glCompileShader(fs);
+    GLuint prog = glCreateProgram();
+    glAttachShader(prog, vs);
+    glAttachShader(prog, fs);
+    glLinkProgram(prog);
+    glDeleteShader(vs);
+    glDeleteShader(fs);
+    glUseProgram(prog);
+
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glfwSwapBuffers(win);
+    glFinish();
+
+    glDeleteProgram(prog);
+    glfwDestroyWindow(win);
+    glfwTerminate();
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    string outPath = argc > 1 ? argv[1] : "bench_startup.json";
+    vector<BenchResult> results;
+
+    if (!firstFrame(true))
+    {
+        cerr << "Falha ao criar o contexto OpenGL" << endl;
+        return 1;
+    }
+
+    // Caminho completo até o primeiro quadro
+    results.push_back(benchRun("primeiro_quadro/glad_completo", [] { firstFrame(true); }, 0, 0, 2, 15));
+    results.push_back(benchRun("primeiro_quadro/minimo", [] { firstFrame(false); }, 0, 0, 2, 15));
+
+    // Só o carregador, com um contexto já aberto
+    glfwInit();
+    GLFWwindow *win = openWindow();
+    results.push_back(benchRun("carregador/glad_completo", [] { loadWith(true); }, 0, 0, 5, 100));
+    results.push_back(benchRun("carregador/minimo", [] { loadWith(false); }, 0, 0, 5, 100));
+    glfwDestroyWindow(win);
+    glfwTerminate();
+
+    for (const BenchResult &r : results)
+        benchPrint(r);
+
+    if (!benchWriteJson(outPath, results))
+    {
+        cerr << "Falha ao gravar " << outPath << endl;
+        return 1;
+    }
+    cout << "Resultados em " << outPath << endl;
+    return 0;
+}
@@ -9,6 +9,10 @@ using namespace std;
 #include <GLFW/glfw3.h>
 #include <GLFW/glfw3.h>
 
+#include "GLLoader.h"
+#include "Regression.h"
+#include "StartupProfiler.h"
+
 void key_callback(GLFWwindow *window, int key, int scancode, int action, int mode);
 
 int setupShader();
@@ -37,14 +41,16 @@ const GLchar *fragmentShaderSource = R"(
 
 int main()
 {
-	glfwInit();
+	PROFILE_PHASE("glfwInit", glfwInit());
 
 	 glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
 	 glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
 	 glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
 	 glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 
-	GLFWwindow *window = glfwCreateWindow(WIDTH, HEIGHT, "Ola Triangulo! -- Rossana", nullptr, nullptr);
+	regressionInit("Lista1_Exercicio5c");
+
+	GLFWwindow *window = PROFILE_PHASE("glfwCreateWindow", glfwCreateWindow(WIDTH, HEIGHT, "Ola Triangulo! -- Rossana", nullptr, nullptr));
 	if (!window)
 	{
 		std::cerr << "Falha ao criar a janela GLFW" << std::endl;
@@ -55,7 +61,7 @@ int main()
 
 	glfwSetKeyCallback(window, key_callback);
 
-	if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+	if (!PROFILE_PHASE("loadGL", loadGL((GLADloadproc)glfwGetProcAddress)))
 	{
 		std::cerr << "Falha ao inicializar GLAD" << std::endl;
 		return -1;
@@ -70,9 +76,9 @@ int main()
 	glfwGetFramebufferSize(window, &width, &height);
 	glViewport(0, 0, width, height);
 
-	GLuint shaderID = setupShader();
+	GLuint shaderID = PROFILE_PHASE("setupShader", setupShader());
 
-	GLuint VAO = setupGeometry();
+	GLuint VAO = PROFILE_PHASE("setupGeometry", setupGeometry());
 
 	GLint colorLoc = glGetUniformLocation(shaderID, "inputColor");
 
@@ -98,11 +104,12 @@ int main()
 
 		// glBindVertexArray(0); // Desnecessário aqui, pois não há múltiplos VAOs
 
-		glfwSwapBuffers(window);
+		regressionFrame(window);
+		PROFILE_FIRST_FRAME(glfwSwapBuffers(window));
 	}
 	glDeleteVertexArrays(1, &VAO);
 	glfwTerminate();
-	return 0;
+	return regressionResult();
 }
 
 void key_callback(GLFWwindow *window, int key, int scancode, int action, int mode)
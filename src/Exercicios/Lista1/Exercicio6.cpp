@@ -10,6 +10,13 @@ using namespace std;
 #include <GLFW/glfw3.h>
 #include <GLFW/glfw3.h>
 
+#include "AntiAlias.h"
+#include "GLLoader.h"
+#include "Geometry.h"
+#include "Regression.h"
+#include "StartupProfiler.h"
+#include "StaticLayer.h"
+
 void key_callback(GLFWwindow *window, int key, int scancode, int action, int mode);
 
 int setupShader();
@@ -40,14 +47,16 @@ const GLchar *fragmentShaderSource = R"(
 
 int main()
 {
-	glfwInit();
+	PROFILE_PHASE("glfwInit", glfwInit());
 
 	 glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
 	 glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
 	 glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
 	 glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 
-	GLFWwindow *window = glfwCreateWindow(WIDTH, HEIGHT, "Ola Triangulo! -- Rossana", nullptr, nullptr);
+	regressionInit(aaRegressionName("Lista1_Exercicio6").c_str());
+
+	GLFWwindow *window = PROFILE_PHASE("glfwCreateWindow", glfwCreateWindow(WIDTH, HEIGHT, "Ola Triangulo! -- Rossana", nullptr, nullptr));
 	if (!window)
 	{
 		std::cerr << "Falha ao criar a janela GLFW" << std::endl;
@@ -58,7 +67,7 @@ int main()
 
 	glfwSetKeyCallback(window, key_callback);
 
-	if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+	if (!PROFILE_PHASE("loadGL", loadGL((GLADloadproc)glfwGetProcAddress)))
 	{
 		std::cerr << "Falha ao inicializar GLAD" << std::endl;
 		return -1;
@@ -73,37 +82,61 @@ int main()
 	glfwGetFramebufferSize(window, &width, &height);
 	glViewport(0, 0, width, height);
 
-	GLuint shaderID = setupShader();
+	GLuint shaderID = PROFILE_PHASE("setupShader", setupShader());
+
+	// FCG_AA escolhe o antisserrilhado; o analítico troca o programa
+	AntiAliasing aa;
+	if (aa.mode() == AAMode::Analytic)
+	{
+		glDeleteProgram(shaderID);
+		shaderID = aa.analyticProgram(vertexShaderSource);
+		aa.setEdgeMasks(shaderID, AA_EDGES_FAN, AA_EDGES_FAN);
+	}
 
-	GLuint VAO = setupGeometry();
+	GLuint VAO = PROFILE_PHASE("setupGeometry", setupGeometry());
 
 	GLint colorLoc = glGetUniformLocation(shaderID, "inputColor");
 
 	glUseProgram(shaderID); // Reseta o estado do shader para evitar problemas futuros
 
+	StaticLayer layer; // FCG_LAYERS=1 liga a camada (desligada: redesenha todo quadro)
+
 	while (!glfwWindowShouldClose(window))
 	{
 		glfwPollEvents();
 
-		glClearColor(0.0f, 0.0f, 0.0f, 1.0f); // cor de fundo
-		glClear(GL_COLOR_BUFFER_BIT);
+		glfwGetFramebufferSize(window, &width, &height);
+		// A forma não muda: desenhada uma vez na camada e só copiada nos quadros seguintes
+		if (layer.begin(width, height))
+		{
+			aa.beginFrame(width, height);
 
-		glLineWidth(10);
-		glPointSize(20);
+			glClearColor(0.0f, 0.0f, 0.0f, 1.0f); // cor de fundo
+			glClear(GL_COLOR_BUFFER_BIT);
 
-		glBindVertexArray(VAO); // Conectando ao buffer de geometria
+			glLineWidth(10);
+			glPointSize(20);
 
-		glUniform4f(colorLoc, 1.0f, 0.0f, 0.0f, 1.0f);
+			glBindVertexArray(VAO); // Conectando ao buffer de geometria
 
-		glDrawArrays(GL_TRIANGLES, 0, segments * 9);
+			glUniform4f(colorLoc, 1.0f, 0.0f, 0.0f, 1.0f);
 
-		// glBindVertexArray(0); // Desnecessário aqui, pois não há múltiplos VAOs
+			glDrawArrays(GL_TRIANGLES, 0, segments * 9);
 
-		glfwSwapBuffers(window);
+			// glBindVertexArray(0); // Desnecessário aqui, pois não há múltiplos VAOs
+
+			aa.endFrame(layer.framebuffer());
+			layer.end();
+		}
+		layer.draw();
+		regressionFrame(window);
+		PROFILE_FIRST_FRAME(glfwSwapBuffers(window));
 	}
 	glDeleteVertexArrays(1, &VAO);
+	aa.release();
+	layer.release();
 	glfwTerminate();
-	return 0;
+	return regressionResult();
 }
 
 void key_callback(GLFWwindow *window, int key, int scancode, int action, int mode)
@@ -160,23 +193,7 @@ int setupGeometry()
 	float radius = 0.5f;
 	GLfloat vertices[segments * 9];
 
-	for (int i = 0; i < segments; ++i) {
-		float theta1 = 2.0f * M_PI * i / segments;
-		float theta2 = 2.0f * M_PI * (i + 1) / segments;
-
-		// Centro do triângulo
-		vertices[i*9] = centerX;
-		vertices[i*9+1] = centerY;
-		vertices[i*9+2] = 0.0f;
-
-		vertices[i*9+3] = centerX + radius * cos(theta1);
-		vertices[i*9+4] = centerY + radius * sin(theta1);
-		vertices[i*9+5] = 0.0f;
-
-		vertices[i*9+6] = centerX + radius * cos(theta2);
-		vertices[i*9+7] = centerY + radius * sin(theta2);
-		vertices[i*9+8] = 0.0f;
-	}
+	circleFan(vertices, segments, segments, centerX, centerY, radius);
 
 	GLuint VBO, VAO;
 	// Geração do identificador do VBO
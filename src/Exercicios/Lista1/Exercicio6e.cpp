@@ -10,6 +10,13 @@ using namespace std;
 #include <GLFW/glfw3.h>
 #include <GLFW/glfw3.h>
 
+#include "AntiAlias.h"
+#include "GLLoader.h"
+#include "Geometry.h"
+#include "Regression.h"
+#include "StartupProfiler.h"
+#include "StaticLayer.h"
+
 void key_callback(GLFWwindow *window, int key, int scancode, int action, int mode);
 
 int setupShader();
@@ -40,14 +47,16 @@ const GLchar *fragmentShaderSource = R"(
 
 int main()
 {
-	glfwInit();
+	PROFILE_PHASE("glfwInit", glfwInit());
 
 	 glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
 	 glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
 	 glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
 	 glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 
-	GLFWwindow *window = glfwCreateWindow(WIDTH, HEIGHT, "Ola Triangulo! -- Rossana", nullptr, nullptr);
+	regressionInit(aaRegressionName("Lista1_Exercicio6e").c_str());
+
+	GLFWwindow *window = PROFILE_PHASE("glfwCreateWindow", glfwCreateWindow(WIDTH, HEIGHT, "Ola Triangulo! -- Rossana", nullptr, nullptr));
 	if (!window)
 	{
 		std::cerr << "Falha ao criar a janela GLFW" << std::endl;
@@ -58,7 +67,7 @@ int main()
 
 	glfwSetKeyCallback(window, key_callback);
 
-	if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+	if (!PROFILE_PHASE("loadGL", loadGL((GLADloadproc)glfwGetProcAddress)))
 	{
 		std::cerr << "Falha ao inicializar GLAD" << std::endl;
 		return -1;
@@ -73,37 +82,61 @@ int main()
 	glfwGetFramebufferSize(window, &width, &height);
 	glViewport(0, 0, width, height);
 
-	GLuint shaderID = setupShader();
+	GLuint shaderID = PROFILE_PHASE("setupShader", setupShader());
 
-	GLuint VAO = setupGeometry();
+	// FCG_AA escolhe o antisserrilhado; o analítico troca o programa
+	AntiAliasing aa;
+	if (aa.mode() == AAMode::Analytic)
+	{
+		glDeleteProgram(shaderID);
+		shaderID = aa.analyticProgram(vertexShaderSource);
+		aa.setEdgeMasks(shaderID, AA_EDGES_FAN, AA_EDGES_FAN);
+	}
+
+	GLuint VAO = PROFILE_PHASE("setupGeometry", setupGeometry());
 
 	GLint colorLoc = glGetUniformLocation(shaderID, "inputColor");
 
 	glUseProgram(shaderID); // Reseta o estado do shader para evitar problemas futuros
 
+	StaticLayer layer; // FCG_LAYERS=1 liga a camada (desligada: redesenha todo quadro)
+
 	while (!glfwWindowShouldClose(window))
 	{
 		glfwPollEvents();
 
-		glClearColor(0.0f, 0.0f, 0.0f, 1.0f); // cor de fundo
-		glClear(GL_COLOR_BUFFER_BIT);
+		glfwGetFramebufferSize(window, &width, &height);
+		// A forma não muda: desenhada uma vez na camada e só copiada nos quadros seguintes
+		if (layer.begin(width, height))
+		{
+			aa.beginFrame(width, height);
+
+			glClearColor(0.0f, 0.0f, 0.0f, 1.0f); // cor de fundo
+			glClear(GL_COLOR_BUFFER_BIT);
 
-		glLineWidth(10);
-		glPointSize(20);
+			glLineWidth(10);
+			glPointSize(20);
 
-		glBindVertexArray(VAO); // Conectando ao buffer de geometria
+			glBindVertexArray(VAO); // Conectando ao buffer de geometria
 
-		glUniform4f(colorLoc, 1.0f, 0.0f, 0.0f, 1.0f);
+			glUniform4f(colorLoc, 1.0f, 0.0f, 0.0f, 1.0f);
 
-		glDrawArrays(GL_TRIANGLES, 0, segments * 3 * 2);
+			glDrawArrays(GL_TRIANGLES, 0, segments * 3 * 2);
 
-		// glBindVertexArray(0); // Desnecessário aqui, pois não há múltiplos VAOs
+			// glBindVertexArray(0); // Desnecessário aqui, pois não há múltiplos VAOs
 
-		glfwSwapBuffers(window);
+			aa.endFrame(layer.framebuffer());
+			layer.end();
+		}
+		layer.draw();
+		regressionFrame(window);
+		PROFILE_FIRST_FRAME(glfwSwapBuffers(window));
 	}
 	glDeleteVertexArrays(1, &VAO);
+	aa.release();
+	layer.release();
 	glfwTerminate();
-	return 0;
+	return regressionResult();
 }
 
 void key_callback(GLFWwindow *window, int key, int scancode, int action, int mode)
@@ -161,34 +194,7 @@ int setupGeometry()
 	float radius2 = 0.18f;
 	GLfloat vertices[segments * 9 * 2];
 
-	for (int i = 0; i < segments; ++i) {
-		float theta1 = 4.08 + 2.0f * M_PI * i / segments;
-		float theta2 = 4.08 + 2.0f * M_PI * (i + 1) / segments;
-
-		vertices[i*18] = centerX;
-		vertices[i*18+1] = centerY;
-		vertices[i*18+2] = 0.0f;
-
-		vertices[i*18+3] = centerX + radius2 * cos(theta1);
-		vertices[i*18+4] = centerY + radius2 * sin(theta1);
-		vertices[i*18+5] = 0.0f;
-
-		vertices[i*18+6] = centerX + radius * cos(theta2);
-		vertices[i*18+7] = centerY + radius * sin(theta2);
-		vertices[i*18+8] = 0.0f;
-
-		vertices[i*18+9] = centerX;
-		vertices[i*18+10] = centerY;
-		vertices[i*18+11] = 0.0f;
-
-		vertices[i*18+12] = centerX + radius * cos(theta1);
-		vertices[i*18+13] = centerY + radius * sin(theta1);
-		vertices[i*18+14] = 0.0f;
-
-		vertices[i*18+15] = centerX + radius2 * cos(theta2);
-		vertices[i*18+16] = centerY + radius2 * sin(theta2);
-		vertices[i*18+17] = 0.0f;
-	}
+	starFan(vertices, segments, centerX, centerY, radius, radius2, 4.08);
 
 	GLuint VBO, VAO;
 	// Geração do identificador do VBO
@@ -2,6 +2,8 @@
 #include <string>
 #include <assert.h>
 #include <cmath>
+#include <cstdlib>
+#include <vector>
 
 using namespace std;
 
@@ -10,6 +12,13 @@ using namespace std;
 #include <GLFW/glfw3.h>
 #include <GLFW/glfw3.h>
 
+#include "FeedbackCache.h"
+#include "GLLoader.h"
+#include "Geometry.h"
+#include "Regression.h"
+#include "StartupProfiler.h"
+#include "TessArcs.h"
+
 void key_callback(GLFWwindow *window, int key, int scancode, int action, int mode);
 
 int setupShader();
@@ -19,6 +28,23 @@ const GLuint WIDTH = 800, HEIGHT = 800;
 
 const int segments = 190;
 
+// Espaçamento da espiral no modo FCG_FEEDBACK (setas para cima e para baixo)
+float spiralB = 0.02f;
+
+// Gerador da espiral para o cache de transform feedback: mesmo r = a + b*theta
+// de spiral() em Geometry.h, um vértice por gl_VertexID
+const GLchar *spiralGeneratorSource = R"(
+ #version 400
+ uniform float params[8]; // a, b, passo de theta
+ out vec3 outPosition;
+ void main()
+ {
+	 float theta = gl_VertexID * params[2];
+	 float radius = params[0] + params[1] * theta;
+	 outPosition = vec3(radius * cos(theta), radius * sin(theta), 0.0);
+ }
+ )";
+
 const GLchar *vertexShaderSource = R"(
  #version 400
  layout (location = 0) in vec3 position;
@@ -40,14 +66,16 @@ const GLchar *fragmentShaderSource = R"(
 
 int main()
 {
-	glfwInit();
+	PROFILE_PHASE("glfwInit", glfwInit());
 
 	 glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
 	 glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
 	 glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
 	 glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 
-	GLFWwindow *window = glfwCreateWindow(WIDTH, HEIGHT, "Ola Triangulo! -- Rossana", nullptr, nullptr);
+	regressionInit("Lista1_Exercicio7");
+
+	GLFWwindow *window = PROFILE_PHASE("glfwCreateWindow", glfwCreateWindow(WIDTH, HEIGHT, "Ola Triangulo! -- Rossana", nullptr, nullptr));
 	if (!window)
 	{
 		std::cerr << "Falha ao criar a janela GLFW" << std::endl;
@@ -58,7 +86,7 @@ int main()
 
 	glfwSetKeyCallback(window, key_callback);
 
-	if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+	if (!PROFILE_PHASE("loadGL", loadGL((GLADloadproc)glfwGetProcAddress)))
 	{
 		std::cerr << "Falha ao inicializar GLAD" << std::endl;
 		return -1;
@@ -73,14 +101,35 @@ int main()
 	glfwGetFramebufferSize(window, &width, &height);
 	glViewport(0, 0, width, height);
 
-	GLuint shaderID = setupShader();
+	GLuint shaderID = PROFILE_PHASE("setupShader", setupShader());
 
-	GLuint VAO = setupGeometry();
+	GLuint VAO = PROFILE_PHASE("setupGeometry", setupGeometry());
 
 	GLint colorLoc = glGetUniformLocation(shaderID, "inputColor");
 
 	glUseProgram(shaderID); // Reseta o estado do shader para evitar problemas futuros
 
+	// Com FCG_TESS=1 a espiral é gerada na GPU pela tesselação, um patch por volta
+	const char *tessEnv = getenv("FCG_TESS");
+	bool useTess = tessEnv && tessEnv[0] == '1';
+	TessArcRenderer tess;
+	if (useTess)
+	{
+		std::vector<TessArc> arcs;
+		tessSpiral(arcs, 0.0f, 0.0f, 0.0f, 0.02f, (segments - 1) * 0.1f);
+		useTess = tess.init();
+		if (useTess)
+			tess.upload(arcs);
+	}
+
+	// Com FCG_FEEDBACK=1 a espiral é calculada por shader e guardada por transform
+	// feedback; só é recalculada quando as setas mudam o espaçamento
+	const char *feedbackEnv = getenv("FCG_FEEDBACK");
+	bool useFeedback = !useTess && feedbackEnv && feedbackEnv[0] == '1';
+	FeedbackCache spiralCache;
+	if (useFeedback)
+		useFeedback = spiralCache.init(spiralGeneratorSource, segments);
+
 	while (!glfwWindowShouldClose(window))
 	{
 		glfwPollEvents();
@@ -91,25 +140,49 @@ int main()
 		glLineWidth(10);
 		glPointSize(20);
 
-		glBindVertexArray(VAO); // Conectando ao buffer de geometria
-
-		glUniform4f(colorLoc, 1.0f, 0.0f, 0.0f, 1.0f);
-
-		glDrawArrays(GL_LINE_STRIP, 0, segments);
+		if (useTess)
+		{
+			glfwGetFramebufferSize(window, &width, &height);
+			tess.drawStroke(width, height, 1.0f, 0.0f, 0.0f, 1.0f);
+		}
+		else if (useFeedback)
+		{
+			const float params[] = {0.0f, spiralB, 0.1f};
+			spiralCache.update(params, 3);
+			glUniform4f(colorLoc, 1.0f, 0.0f, 0.0f, 1.0f);
+			spiralCache.draw(GL_LINE_STRIP);
+		}
+		else
+		{
+			glBindVertexArray(VAO); // Conectando ao buffer de geometria
+
+			glUniform4f(colorLoc, 1.0f, 0.0f, 0.0f, 1.0f);
+
+			glDrawArrays(GL_LINE_STRIP, 0, segments);
+		}
 
 		// glBindVertexArray(0); // Desnecessário aqui, pois não há múltiplos VAOs
 
-		glfwSwapBuffers(window);
+		regressionFrame(window);
+		PROFILE_FIRST_FRAME(glfwSwapBuffers(window));
 	}
 	glDeleteVertexArrays(1, &VAO);
+	tess.release();
+	if (useFeedback)
+		cout << "Cache da espiral: " << spiralCache.hits() << " acertos, " << spiralCache.misses() << " falhas" << endl;
+	spiralCache.release();
 	glfwTerminate();
-	return 0;
+	return regressionResult();
 }
 
 void key_callback(GLFWwindow *window, int key, int scancode, int action, int mode)
 {
 	if (key == GLFW_KEY_ESCAPE && action == GLFW_PRESS)
 		glfwSetWindowShouldClose(window, GL_TRUE);
+	if (key == GLFW_KEY_UP && action != GLFW_RELEASE)
+		spiralB += 0.002f;
+	if (key == GLFW_KEY_DOWN && action != GLFW_RELEASE && spiralB > 0.004f)
+		spiralB -= 0.002f;
 }
 
 int setupShader()
@@ -162,14 +235,7 @@ int setupGeometry()
 
 	GLfloat vertices[segments * 3];
 
-	for (int i = 0; i < segments; ++i) {
-		float theta = i * 0.1f;
-		float radius = a + b * theta;
-
-		vertices[i*3] = centerX + radius * cos(theta);
-		vertices[i*3 + 1] = centerY + radius * sin(theta);
-		vertices[i*3 + 2] = 0.0f;
-	}
+	spiral(vertices, segments, centerX, centerY, a, b, 0.1f);
 
 	GLuint VBO, VAO;
 	// Geração do identificador do VBO
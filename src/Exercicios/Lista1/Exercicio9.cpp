@@ -1,16 +1,36 @@
 #include <iostream>
+#include <cstdlib>
 #include <string>
+#include <thread>
+#include <vector>
 
 using namespace std;
 
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 
+#include "AntiAlias.h"
+#include "Canvas.h"
+#include "GLLoader.h"
+#include "GpuTimer.h"
+#include "RectBatch.h"
+#include "Regression.h"
+#include "StartupProfiler.h"
+#include "StaticLayer.h"
+#include "TextHud.h"
+#include "TextureAtlas.h"
+#include "TextureStreamer.h"
+#include "Trace.h"
+
 void   key_callback(GLFWwindow *w, int k, int sc, int action, int mods);
 
 GLuint setupShader();
+GLuint buildProgram(const GLchar *vs, const GLchar *fs);
 void   setupGeometry();
+void   drawHouseCanvas(Canvas &c);
+void   addHouseRects(RectBatch &r);
 static void makeVAO(const GLfloat* data, size_t count, GLuint& vaoOut);
+static std::vector<unsigned char> roofTiles(int size);
 
 const GLuint WIDTH = 800, HEIGHT = 600;
 
@@ -27,107 +47,289 @@ out vec4 color;
 void main() { color = inputColor; }
 )";
 
-GLuint vaoRoofBorder, vaoRoofFill;
+// Fachada e telhado texturizados a partir do atlas: a coordenada de textura sai da
+// própria posição (imagem repetida) e o z do vértice diz qual imagem (0 fachada,
+// 1 telhado); regions traduz isso para a região do atlas
+const GLchar *texVsSrc = R"(
+#version 400
+layout (location = 0) in vec3 position;
+uniform int regions[2];
+out vec2 uv;
+flat out int region;
+void main() {
+    uv = vec2(position.x, -position.y) * 3.0;
+    region = regions[int(position.z)];
+    gl_Position = vec4(position.xy, 0.0, 1.0);
+}
+)";
+
+// A repetição é feita com fract() dentro da região; as derivadas vêm do uv
+// contínuo para o nível de mipmap não saltar na emenda, e as duas regiões
+// entram no atlas com wrap (gutter com o lado oposto) para o filtro não
+// mostrar a costura
+const GLchar *texFsSrc = R"(
+#version 400
+in vec2 uv;
+flat in int region;
+uniform sampler2DArray atlas;
+uniform samplerBuffer remap;
+out vec4 color;
+void main() {
+    vec4 r = texelFetch(remap, 2 * region);
+    float layer = texelFetch(remap, 2 * region + 1).x;
+    vec2 size = r.zw - r.xy;
+    color = textureGrad(atlas, vec3(r.xy + fract(uv) * size, layer), dFdx(uv) * size, dFdy(uv) * size);
+}
+)";
+
+GLuint vaoRoofBorder;
 GLuint vaoWallLeft, vaoWallRight;
 GLuint vaoWindowFill, vaoWindowBorder, vaoWinCrossV, vaoWinCrossH;
 GLuint vaoDoorFrame, vaoDoorFill, vaoGround;
 GLuint vaoRoofBase;
+GLuint vaoTextured; // fachada (6 vértices) e telhado (3)
 
 int main() {
-    glfwInit();
+    PROFILE_PHASE("glfwInit", glfwInit());
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
     glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 
-    GLFWwindow *win = glfwCreateWindow(WIDTH, HEIGHT, "Casa", nullptr, nullptr);
+    regressionInit(aaRegressionName("Lista1_Exercicio9").c_str());
+
+    GLFWwindow *win = PROFILE_PHASE("glfwCreateWindow", glfwCreateWindow(WIDTH, HEIGHT, "Casa", nullptr, nullptr));
     if (!win) { cerr << "Falha ao criar a janela\n"; glfwTerminate(); return -1; }
     glfwMakeContextCurrent(win);
     glfwSetKeyCallback(win, key_callback);
 
-    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) { cerr << "Falha GLAD\n"; return -1; }
+    if (!PROFILE_PHASE("loadGL", loadGL((GLADloadproc)glfwGetProcAddress))) { cerr << "Falha GLAD\n"; return -1; }
 
     int fbw, fbh; glfwGetFramebufferSize(win, &fbw, &fbh);
     glViewport(0, 0, fbw, fbh);
 
-    GLuint prog = setupShader();
+    GLuint prog = PROFILE_PHASE("setupShader", setupShader());
+    AntiAliasing aa; // FCG_AA; o analítico troca o programa das partes de cor sólida
+    if (aa.mode() == AAMode::Analytic) { glDeleteProgram(prog); prog = aa.analyticProgram(vsSrc); }
     glUseProgram(prog);
-    setupGeometry();
+    PROFILE_PHASE("setupGeometry", setupGeometry());
 
     GLint uColor = glGetUniformLocation(prog, "inputColor");
+    GLint uEdges = glGetUniformLocation(prog, "edgeMasks"); // -1 fora do modo analítico
+
+    // Fachada e telhado numa só textura (atlas): um bind e um draw para os dois.
+    // As telhas são geradas aqui; os tijolos são decodificados em segundo plano e
+    // entram no atlas quando chegam, até lá a fachada usa uma região branca
+    GLuint texProg = buildProgram(texVsSrc, texFsSrc);
+    glUseProgram(texProg);
+    glUniform1i(glGetUniformLocation(texProg, "atlas"), 0);
+    glUniform1i(glGetUniformLocation(texProg, "remap"), 1);
+    GLint uRegions = glGetUniformLocation(texProg, "regions");
+    TextureAtlas atlas(256);
+    const unsigned char white[4] = {255, 255, 255, 255};
+    std::vector<unsigned char> tiles = roofTiles(64);
+    GLint regions[2] = {atlas.add(white, 1, 1), atlas.add(tiles.data(), 64, 64, true)};
+    atlas.flush();
+    glUniform1iv(uRegions, 2, regions);
+    glUseProgram(prog);
+    TextureStreamer textures;
+    int texWall = textures.loadInto(atlas, "assets/textures/tijolos.png", true);
+    // Na regressão a imagem capturada não pode depender de quando a decodificação
+    // termina: espera os tijolos (ou a falha) antes do primeiro quadro
+    while (regressionEnabled() && textures.busy()) {
+        textures.update();
+        std::this_thread::yield();
+    }
 
     double prev = glfwGetTime(), cd = 0.1;
+    // FCG_CANVAS=1: as partes de cor sólida saem de um Canvas (um draw) em vez dos 12 VAOs
+    const char *canvasEnv = getenv("FCG_CANVAS");
+    bool useCanvas = canvasEnv && canvasEnv[0] == '1';
+    Canvas canvas;
+    if (useCanvas) useCanvas = canvas.init();
+
+    // FCG_RECTS=1: os retângulos viram instâncias (24 bytes cada) num draw; só o
+    // contorno do telhado continua em VAO
+    const char *rectsEnv = getenv("FCG_RECTS");
+    bool useRects = !useCanvas && rectsEnv && rectsEnv[0] == '1';
+    RectBatch rects;
+    if (useRects) useRects = rects.init();
+    if (useRects) addHouseRects(rects);
+
+    GpuTimer gpu; // tempo de GPU por parte da casa
+
+    // A casa não muda: desenhada uma vez numa camada e copiada a cada quadro.
+    // Refeita quando a janela muda ou a textura da fachada chega (FCG_LAYERS=1 liga)
+    StaticLayer house;
+
+    // Painel de FPS/tempo de quadro na janela; FCG_HUD=0 desliga
+    const char *hudEnv = getenv("FCG_HUD");
+    StatsHud hud;
+    if (!(hudEnv && hudEnv[0] == '0')) hud.init();
+
     while (!glfwWindowShouldClose(win)) {
+        TRACE_SCOPE("quadro");
         double now = glfwGetTime(), dt = now - prev; prev = now;
-        cd -= dt;
-        if (cd <= 0.0 && dt > 0.0) {
-            double fps = 1.0 / dt;
-            char buf[96]; sprintf(buf, "Casinha - OpenGL | FPS %.2lf", fps);
-            glfwSetWindowTitle(win, buf);
-            cd = 0.1;
+        if (hud.enabled()) {
+            hud.frame(dt);
+        } else {
+            // Sem fonte para o HUD: FPS na barra de título, como antes
+            cd -= dt;
+            if (cd <= 0.0 && dt > 0.0) {
+                double fps = 1.0 / dt;
+                char buf[96]; sprintf(buf, "Casinha - OpenGL | FPS %.2lf", fps);
+                glfwSetWindowTitle(win, buf);
+                cd = 0.1;
+            }
+        }
+
+        { TRACE_SCOPE("poll"); glfwPollEvents(); }
+        gpu.beginFrame();
+        glfwGetFramebufferSize(win, &fbw, &fbh);
+
+        { TRACE_SCOPE("upload"); textures.update(); }
+        if (textures.ready(texWall) && regions[0] != textures.region(texWall)) {
+            regions[0] = textures.region(texWall);
+            atlas.flush();
+            glUseProgram(texProg);
+            glUniform1iv(uRegions, 2, regions);
+            glUseProgram(prog);
+            house.markDirty();
         }
 
-        glfwPollEvents();
-        glClearColor(1.0f, 1.0f, 1.0f, 1.0f);  // fundo branco
-        glClear(GL_COLOR_BUFFER_BIT);
-
-        // Telhado
-        glBindVertexArray(vaoRoofBorder);
-        glUniform4f(uColor, 0.0f, 0.0f, 0.0f, 1.0f);
-        glDrawArrays(GL_TRIANGLES, 0, 3);
-
-        // Paredes
-        glBindVertexArray(vaoWallLeft);
-        glDrawArrays(GL_TRIANGLES, 0, 6);
-        glBindVertexArray(vaoWallRight);
-        glDrawArrays(GL_TRIANGLES, 0, 6);
-
-        // Moldura janela
-        glBindVertexArray(vaoWindowBorder);
-        glDrawArrays(GL_TRIANGLES, 0, 6);
-
-        // Porta
-        glBindVertexArray(vaoDoorFrame);
-        glDrawArrays(GL_TRIANGLES, 0, 6);
-        glBindVertexArray(vaoDoorFill);
-        glUniform4f(uColor, 0.36f, 0.18f, 0.12f, 1.0f);
-        glDrawArrays(GL_TRIANGLES, 0, 6);
-
-        // Janela
-        glBindVertexArray(vaoWindowFill);
-        glUniform4f(uColor, 1.0f, 1.0f, 0.0f, 1.0f);
-        glDrawArrays(GL_TRIANGLES, 0, 6);
-
-        glUniform4f(uColor, 0.0f, 0.0f, 0.0f, 1.0f);
-        glBindVertexArray(vaoWinCrossV);
-        glDrawArrays(GL_TRIANGLES, 0, 6);
-        glBindVertexArray(vaoWinCrossH);
-        glDrawArrays(GL_TRIANGLES, 0, 6);
-
-        // Telhado
-        glBindVertexArray(vaoRoofFill);
-        glUniform4f(uColor, 0.80f, 0.00f, 0.00f, 1.0f);
-        glDrawArrays(GL_TRIANGLES, 0, 3);
-
-        glBindVertexArray(vaoRoofBase);
-        glUniform4f(uColor, 0.0f, 0.0f, 0.0f, 1.0f);
-        glDrawArrays(GL_TRIANGLES, 0, 6);
-
-        // Chão
-        glBindVertexArray(vaoGround);
-        glUniform4f(uColor, 1.0f, 0.5f, 0.0f, 1.0f);
-        glDrawArrays(GL_TRIANGLES, 0, 6);
-
-        glfwSwapBuffers(win);
+        if (house.begin(fbw, fbh)) {
+            aa.beginFrame(fbw, fbh);
+            gpu.begin("limpa");
+            glClearColor(1.0f, 1.0f, 1.0f, 1.0f);  // fundo branco
+            glClear(GL_COLOR_BUFFER_BIT);
+            gpu.end();
+
+            {
+                TRACE_SCOPE("draw");
+                // Contorno do telhado: vem antes do telhado texturizado, que o cobre por dentro
+                gpu.begin("telhado");
+                glUseProgram(prog);
+                glUniform2i(uEdges, AA_EDGES_ALL, AA_EDGES_ALL);
+                glBindVertexArray(vaoRoofBorder);
+                glUniform4f(uColor, 0.0f, 0.0f, 0.0f, 1.0f);
+                glDrawArrays(GL_TRIANGLES, 0, 3);
+                glUniform2i(uEdges, AA_EDGES_QUAD_EVEN, AA_EDGES_QUAD_ODD);
+                gpu.end();
+
+                // Fachada e telhado
+                gpu.begin("fachada");
+                glUseProgram(texProg);
+                glActiveTexture(GL_TEXTURE1);
+                glBindTexture(GL_TEXTURE_BUFFER, atlas.remapTexture());
+                glActiveTexture(GL_TEXTURE0);
+                glBindTexture(GL_TEXTURE_2D_ARRAY, atlas.arrayTexture());
+                glBindVertexArray(vaoTextured);
+                glDrawArrays(GL_TRIANGLES, 0, 9);
+                glUseProgram(prog);
+                gpu.end();
+
+                if (useCanvas) {
+                    gpu.begin("canvas");
+                    canvas.beginFrame(fbw, fbh);
+                    drawHouseCanvas(canvas);
+                    canvas.endFrame();
+                    gpu.end();
+                } else if (useRects) {
+                    gpu.begin("retangulos");
+                    rects.draw();
+                    gpu.end();
+                } else {
+                    // Paredes
+                    gpu.begin("paredes");
+                    glBindVertexArray(vaoWallLeft);
+                    glDrawArrays(GL_TRIANGLES, 0, 6);
+                    glBindVertexArray(vaoWallRight);
+                    glDrawArrays(GL_TRIANGLES, 0, 6);
+                    gpu.end();
+
+                    // Moldura janela
+                    gpu.begin("janela");
+                    glBindVertexArray(vaoWindowBorder);
+                    glDrawArrays(GL_TRIANGLES, 0, 6);
+                    gpu.end();
+
+                    // Porta
+                    gpu.begin("porta");
+                    glBindVertexArray(vaoDoorFrame);
+                    glDrawArrays(GL_TRIANGLES, 0, 6);
+                    glBindVertexArray(vaoDoorFill);
+                    glUniform4f(uColor, 0.36f, 0.18f, 0.12f, 1.0f);
+                    glDrawArrays(GL_TRIANGLES, 0, 6);
+                    gpu.end();
+
+                    // Janela
+                    gpu.begin("janela");
+                    glBindVertexArray(vaoWindowFill);
+                    glUniform4f(uColor, 1.0f, 1.0f, 0.0f, 1.0f);
+                    glDrawArrays(GL_TRIANGLES, 0, 6);
+
+                    glUniform4f(uColor, 0.0f, 0.0f, 0.0f, 1.0f);
+                    glBindVertexArray(vaoWinCrossV);
+                    glDrawArrays(GL_TRIANGLES, 0, 6);
+                    glBindVertexArray(vaoWinCrossH);
+                    glDrawArrays(GL_TRIANGLES, 0, 6);
+                    gpu.end();
+
+                    // Base do telhado
+                    gpu.begin("telhado");
+                    glBindVertexArray(vaoRoofBase);
+                    glUniform4f(uColor, 0.0f, 0.0f, 0.0f, 1.0f);
+                    glDrawArrays(GL_TRIANGLES, 0, 6);
+                    gpu.end();
+
+                    // Chão
+                    gpu.begin("chao");
+                    glBindVertexArray(vaoGround);
+                    glUniform4f(uColor, 1.0f, 0.5f, 0.0f, 1.0f);
+                    glDrawArrays(GL_TRIANGLES, 0, 6);
+                    gpu.end();
+                }
+            }
+            aa.endFrame(house.framebuffer());
+            house.end();
+        }
+
+        gpu.begin("camada");
+        house.draw();
+        gpu.end();
+        gpu.endFrame();
+
+        regressionFrame(win);
+        // Depois da regressão, para o painel não entrar na imagem de referência
+        if (hud.enabled()) {
+            auto q = gpu.passes().find("quadro");
+            if (q != gpu.passes().end()) hud.counter("gpu ms", q->second.last());
+            if (useCanvas) hud.counter("canvas draws", canvas.drawCallCount());
+            if (house.cached()) hud.counter("camada refeita", house.renderCount());
+            hud.draw(fbw, fbh);
+        }
+        { TRACE_SCOPE("swap"); PROFILE_FIRST_FRAME(glfwSwapBuffers(win)); }
     }
 
-    GLuint vaos[] = {vaoRoofBorder,vaoRoofFill,vaoWallLeft,vaoWallRight,
+    GLuint vaos[] = {vaoRoofBorder,vaoRoofBase,vaoWallLeft,vaoWallRight,
                      vaoWindowFill,vaoWindowBorder,vaoWinCrossV,vaoWinCrossH,
-                     vaoDoorFrame,vaoDoorFill,vaoGround};
+                     vaoDoorFrame,vaoDoorFill,vaoGround,vaoTextured};
     for (GLuint v : vaos) glDeleteVertexArrays(1, &v);
+    gpu.finish();
+    if (regressionEnabled())
+        gpu.appendCsv(regressionEnv("FCG_GPU_RESULTS", "regressao_gpu.csv"), "Lista1_Exercicio9");
+    gpu.release();
+    textures.release();
+    atlas.release();
+    house.release();
+    aa.release();
+    canvas.release();
+    rects.release();
+    hud.release();
+    glDeleteProgram(texProg);
 
     glfwTerminate();
-    return 0;
+    return regressionResult();
 }
 
 void key_callback(GLFWwindow *w, int key, int, int action, int) {
@@ -135,14 +337,18 @@ void key_callback(GLFWwindow *w, int key, int, int action, int) {
 }
 
 GLuint setupShader() {
+    return buildProgram(vsSrc, fsSrc);
+}
+
+GLuint buildProgram(const GLchar *vsText, const GLchar *fsText) {
     GLint ok; GLchar log[512];
     GLuint vs = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(vs, 1, &vsSrc, NULL);
+    glShaderSource(vs, 1, &vsText, NULL);
     glCompileShader(vs); glGetShaderiv(vs, GL_COMPILE_STATUS, &ok);
     if (!ok) { glGetShaderInfoLog(vs, 512, NULL, log); cerr << "VS:\n" << log << endl; }
 
     GLuint fs = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(fs, 1, &fsSrc, NULL);
+    glShaderSource(fs, 1, &fsText, NULL);
     glCompileShader(fs); glGetShaderiv(fs, GL_COMPILE_STATUS, &ok);
     if (!ok) { glGetShaderInfoLog(fs, 512, NULL, log); cerr << "FS:\n" << log << endl; }
 
@@ -167,11 +373,70 @@ static void makeVAO(const GLfloat* data, size_t count, GLuint& vaoOut) {
     glBindVertexArray(0);
 }
 
+// Medidas da casa (NDC), usadas pelos VAOs e pelo modo Canvas
+const float yTopHouse =  0.20f;
+const float yBotHouse = -0.55f;
+const float xLeft     = -0.35f;
+const float xRight    =  0.35f;
+const float baseT = 0.03f;                                          // base do telhado
+const float wallW = 0.03f;
+const float xW0 = -0.25f, xW1 = -0.05f, yW0 = -0.05f, yW1 = 0.15f; // corpo amarelo
+const float border = 0.02f;                                         // “traço” preto
+const float cx = 0.5f*(xW0+xW1), cy = 0.5f*(yW0+yW1);
+const float crossT = 0.01f;
+const float xDf0=-0.12f, xDf1=0.12f, yDf0=-0.55f, yDf1=-0.27f;     // moldura da porta
+const float xDi0=-0.08f, xDi1=0.08f, yDi0=-0.55f, yDi1=-0.30f;     // porta
+const float yG1 = yBotHouse;
+const float yG0 = yG1 - 0.035f;
+
+// As partes de cor sólida em chamadas do Canvas, na mesma ordem e cores do loop
+// com VAOs (o contorno do telhado e as partes texturizadas vêm antes)
+void drawHouseCanvas(Canvas &c) {
+    const uint32_t black = canvasColor(0, 0, 0);
+    c.fillRect(xLeft - wallW, yBotHouse, xLeft, yTopHouse, black);
+    c.fillRect(xRight, yBotHouse, xRight + wallW, yTopHouse, black);
+    c.fillRect(xW0 - border, yW0 - border, xW1 + border, yW1 + border, black);
+    c.fillRect(xDf0, yDf0, xDf1, yDf1, black);
+    c.fillRect(xDi0, yDi0, xDi1, yDi1, canvasColor(0.36f, 0.18f, 0.12f));
+    c.fillRect(xW0, yW0, xW1, yW1, canvasColor(1, 1, 0));
+    c.fillRect(cx - crossT, yW0, cx + crossT, yW1, black);
+    c.fillRect(xW0, cy - crossT, xW1, cy + crossT, black);
+    c.fillRect(xLeft, yTopHouse - baseT*0.5f, xRight, yTopHouse + baseT*0.5f, black);
+    c.fillRect(-0.92f, yG0, 0.92f, yG1, canvasColor(1.0f, 0.5f, 0.0f));
+}
+
+// Retângulos da casa para o RectBatch; a janela e sua moldura viram um só com borda
+void addHouseRects(RectBatch &r) {
+    const uint32_t black = canvasColor(0, 0, 0);
+    r.add(xLeft - wallW, yBotHouse, xLeft, yTopHouse, black);
+    r.add(xRight, yBotHouse, xRight + wallW, yTopHouse, black);
+    r.add(xW0 - border, yW0 - border, xW1 + border, yW1 + border, canvasColor(1, 1, 0), border);
+    r.add(xDf0, yDf0, xDf1, yDf1, black);
+    r.add(xDi0, yDi0, xDi1, yDi1, canvasColor(0.36f, 0.18f, 0.12f));
+    r.add(cx - crossT, yW0, cx + crossT, yW1, black);
+    r.add(xW0, cy - crossT, xW1, cy + crossT, black);
+    r.add(xLeft, yTopHouse - baseT*0.5f, xRight, yTopHouse + baseT*0.5f, black);
+    r.add(-0.92f, yG0, 0.92f, yG1, canvasColor(1.0f, 0.5f, 0.0f));
+}
+
+// Telhas geradas na hora (não há arquivo para o telhado): fileiras de 16 px
+// deslocadas meia telha, cada telha escurecendo para baixo, juntas escuras
+static std::vector<unsigned char> roofTiles(int size) {
+    std::vector<unsigned char> px(static_cast<size_t>(size) * size * 4);
+    for (int y = 0; y < size; ++y)
+        for (int x = 0; x < size; ++x) {
+            int ty = y % 16, tx = (x + (y / 16 % 2) * 8) % 16;
+            float shade = (ty == 15 || tx == 0) ? 0.45f : 1.0f - 0.3f * ty / 15.0f;
+            unsigned char *p = &px[(static_cast<size_t>(y) * size + x) * 4];
+            p[0] = static_cast<unsigned char>(204 * shade);
+            p[1] = static_cast<unsigned char>(40 * shade);
+            p[2] = static_cast<unsigned char>(24 * shade);
+            p[3] = 255;
+        }
+    return px;
+}
+
 void setupGeometry() {
-    const float yTopHouse =  0.20f;
-    const float yBotHouse = -0.55f;
-    const float xLeft     = -0.35f;
-    const float xRight    =  0.35f;
 
     // Telhado
     const GLfloat roofBorder[] = {
@@ -180,13 +445,6 @@ void setupGeometry() {
         0.0f,          0.85f,     0.0f
     };
 
-    const GLfloat roofFill[] = {
-        xLeft,  yTopHouse, 0.0f,
-        xRight, yTopHouse, 0.0f,
-        0.0f,   0.80f,     0.0f
-    };
-
-    const float baseT = 0.03f;
     const GLfloat roofBase[] = {
         xLeft,  yTopHouse + baseT*0.5f, 0,
         xRight, yTopHouse + baseT*0.5f, 0,
@@ -196,8 +454,14 @@ void setupGeometry() {
         xLeft,  yTopHouse - baseT*0.5f, 0
     };
 
+    // Fachada (fundo entre as paredes, z = 0) e telhado (z = 1), texturizados pelo atlas
+    const GLfloat textured[] = {
+        xLeft,yBotHouse,0,   xRight,yBotHouse,0,   xRight,yTopHouse,0,
+        xLeft,yBotHouse,0,   xRight,yTopHouse,0,   xLeft,yTopHouse,0,
+        xLeft,yTopHouse,1,   xRight,yTopHouse,1,   0.0f,0.80f,1
+    };
+
     // Paredes
-    const float wallW = 0.03f;
     const GLfloat wallLeft[] = {
         xLeft-wallW,yTopHouse,0,   xLeft,yTopHouse,0,   xLeft,yBotHouse,0,
         xLeft-wallW,yTopHouse,0,   xLeft,yBotHouse,0,   xLeft-wallW,yBotHouse,0
@@ -208,8 +472,6 @@ void setupGeometry() {
     };
 
     // Janela
-    const float xW0 = -0.25f, xW1 = -0.05f, yW0 = -0.05f, yW1 = 0.15f; // corpo amarelo
-    const float border = 0.02f;                                         // “traço” preto
     const GLfloat windowFill[] = {
         xW0,yW0,0,  xW1,yW0,0,  xW1,yW1,0,
         xW0,yW0,0,  xW1,yW1,0,  xW0,yW1,0
@@ -218,8 +480,6 @@ void setupGeometry() {
         xW0-border,yW0-border,0,  xW1+border,yW0-border,0,  xW1+border,yW1+border,0,
         xW0-border,yW0-border,0,  xW1+border,yW1+border,0,  xW0-border,yW1+border,0
     };
-    const float cx = 0.5f*(xW0+xW1), cy = 0.5f*(yW0+yW1);
-    const float crossT = 0.01f;
     const GLfloat winCrossV[] = {
         cx-crossT, yW0, 0,  cx+crossT, yW0, 0,  cx+crossT, yW1, 0,
         cx-crossT, yW0, 0,  cx+crossT, yW1, 0,  cx-crossT, yW1, 0
@@ -230,27 +490,22 @@ void setupGeometry() {
     };
 
     // Porta
-    const float xDf0=-0.12f, xDf1=0.12f, yDf0=-0.55f, yDf1=-0.27f;
     const GLfloat doorFrame[] = {
         xDf0,yDf0,0,  xDf1,yDf0,0,  xDf1,yDf1,0,
         xDf0,yDf0,0,  xDf1,yDf1,0,  xDf0,yDf1,0
     };
-    const float xDi0=-0.08f, xDi1=0.08f, yDi0=-0.55f, yDi1=-0.30f;
     const GLfloat doorFill[] = {
         xDi0,yDi0,0,  xDi1,yDi0,0,  xDi1,yDi1,0,
         xDi0,yDi0,0,  xDi1,yDi1,0,  xDi0,yDi1,0
     };
 
     // Chão
-    const float yG1 = yBotHouse;
-    const float yG0 = yG1 - 0.035f;
     const GLfloat ground[] = {
         -0.92f,yG0,0,   0.92f,yG0,0,   0.92f,yG1,0,
         -0.92f,yG0,0,   0.92f,yG1,0,  -0.92f,yG1,0
     };
 
     makeVAO(roofBorder,   sizeof(roofBorder)/sizeof(GLfloat),   vaoRoofBorder);
-    makeVAO(roofFill,     sizeof(roofFill)/sizeof(GLfloat),     vaoRoofFill);
     makeVAO(roofBase,   sizeof(roofBase)  /sizeof(GLfloat), vaoRoofBase);
     makeVAO(wallLeft,     sizeof(wallLeft)/sizeof(GLfloat),     vaoWallLeft);
     makeVAO(wallRight,    sizeof(wallRight)/sizeof(GLfloat),    vaoWallRight);
@@ -261,4 +516,5 @@ void setupGeometry() {
     makeVAO(doorFrame,    sizeof(doorFrame)/sizeof(GLfloat),    vaoDoorFrame);
     makeVAO(doorFill,     sizeof(doorFill)/sizeof(GLfloat),     vaoDoorFill);
     makeVAO(ground,       sizeof(ground)/sizeof(GLfloat),       vaoGround);
+    makeVAO(textured,     sizeof(textured)/sizeof(GLfloat),     vaoTextured);
 }
\ No newline at end of file
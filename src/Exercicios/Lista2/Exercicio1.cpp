@@ -8,6 +8,11 @@ using namespace std;
 
 #include <GLFW/glfw3.h>
 
+#include "GLLoader.h"
+#include "Regression.h"
+#include "StartupProfiler.h"
+#include "TextHud.h"
+
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
@@ -47,10 +52,12 @@ const GLchar *fragmentShaderSource = R"(
 int main()
 {
 	// Inicialização da GLFW
-	glfwInit();
+	PROFILE_PHASE("glfwInit", glfwInit());
+
+	regressionInit("Lista2_Exercicio1");
 
 	// Criação da janela GLFW
-	GLFWwindow *window = glfwCreateWindow(WIDTH, HEIGHT, "-10,10,-10,10", nullptr, nullptr);
+	GLFWwindow *window = PROFILE_PHASE("glfwCreateWindow", glfwCreateWindow(WIDTH, HEIGHT, "-10,10,-10,10", nullptr, nullptr));
 	if (!window)
 	{
 		std::cerr << "Falha ao criar a janela GLFW" << std::endl;
@@ -63,7 +70,7 @@ int main()
 	glfwSetKeyCallback(window, key_callback);
 
 	// GLAD: carrega todos os ponteiros d funções da OpenGL
-	if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+	if (!PROFILE_PHASE("loadGL", loadGL((GLADloadproc)glfwGetProcAddress)))
 	{
 		std::cerr << "Falha ao inicializar GLAD" << std::endl;
 		return -1;
@@ -76,16 +83,22 @@ int main()
 	cout << "OpenGL version supported " << version << endl;
 
 	// Compilando e buildando o programa de shader
-	GLuint shaderID = setupShader();
+	GLuint shaderID = PROFILE_PHASE("setupShader", setupShader());
 
 	// Gerando um buffer simples, com a geometria de um triângulo
-	GLuint VAO = setupGeometry();
+	GLuint VAO = PROFILE_PHASE("setupGeometry", setupGeometry());
 
 	glUseProgram(shaderID);
 
 	double prev_s = glfwGetTime();
 	double title_countdown_s = 0.1;
 
+	// Painel de FPS/tempo de quadro; FCG_HUD=0 desliga
+	const char *hudEnv = getenv("FCG_HUD");
+	StatsHud hud;
+	if (!(hudEnv && hudEnv[0] == '0'))
+		hud.init();
+
 	// Criação da matriz de projeção - EXERCÍCIO 1: limites -10 a 10
 	mat4 projection = ortho(-10.0, 10.0, -10.0, 10.0, -1.0, 1.0);
 
@@ -95,20 +108,25 @@ int main()
 	// Loop da aplicação - "game loop"
 	while (!glfwWindowShouldClose(window))
 	{
-		// Calcula e mostra o FPS na barra de título
+		// FPS no painel da janela; sem fonte, na barra de título
 		{
 			double curr_s = glfwGetTime();
 			double elapsed_s = curr_s - prev_s;
 			prev_s = curr_s;
 
-			title_countdown_s -= elapsed_s;
-			if (title_countdown_s <= 0.0 && elapsed_s > 0.0)
+			if (hud.enabled())
+				hud.frame(elapsed_s);
+			else
 			{
-				double fps = 1.0 / elapsed_s;
-				char tmp[256];
-				sprintf(tmp, "-10,10,-10,10\tFPS %.2lf", fps);
-				glfwSetWindowTitle(window, tmp);
-				title_countdown_s = 0.1;
+				title_countdown_s -= elapsed_s;
+				if (title_countdown_s <= 0.0 && elapsed_s > 0.0)
+				{
+					double fps = 1.0 / elapsed_s;
+					char tmp[256];
+					sprintf(tmp, "-10,10,-10,10\tFPS %.2lf", fps);
+					glfwSetWindowTitle(window, tmp);
+					title_countdown_s = 0.1;
+				}
 			}
 		}
 
@@ -129,15 +147,19 @@ int main()
 		glDrawArrays(GL_TRIANGLES, 0, 3);
 		glBindVertexArray(0);
 
+		regressionFrame(window);
+		// Depois da regressão, para o painel não entrar na imagem de referência
+		hud.draw(width, height);
 		// Troca os buffers da tela
-		glfwSwapBuffers(window);
+		PROFILE_FIRST_FRAME(glfwSwapBuffers(window));
 	}
 
 	// Pede pra OpenGL desalocar os buffers
 	glDeleteVertexArrays(1, &VAO);
+	hud.release();
 	// Finaliza a execução da GLFW
 	glfwTerminate();
-	return 0;
+	return regressionResult();
 }
 
 // Função de callback de teclado
@@ -10,6 +10,10 @@ using namespace std;
 // GLFW
 #include <GLFW/glfw3.h>
 
+#include "GLLoader.h"
+#include "Regression.h"
+#include "StartupProfiler.h"
+
 // GLM
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
@@ -56,10 +60,12 @@ const GLchar *fragmentShaderSource = R"(
 int main()
 {
 	// Inicialização da GLFW
-	glfwInit();
+	PROFILE_PHASE("glfwInit", glfwInit());
+
+	regressionInit("Lista2_Exercicio4");
 
 	// Criação da janela GLFW
-	GLFWwindow *window = glfwCreateWindow(WIDTH, HEIGHT, "Viewport: Quadrante Superior Direito", nullptr, nullptr);
+	GLFWwindow *window = PROFILE_PHASE("glfwCreateWindow", glfwCreateWindow(WIDTH, HEIGHT, "Viewport: Quadrante Superior Direito", nullptr, nullptr));
 	if (!window)
 	{
 		std::cerr << "Falha ao criar a janela GLFW" << std::endl;
@@ -72,7 +78,7 @@ int main()
 	glfwSetKeyCallback(window, key_callback);
 
 	// GLAD: carrega ponteiros das funções da OpenGL
-	if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+	if (!PROFILE_PHASE("loadGL", loadGL((GLADloadproc)glfwGetProcAddress)))
 	{
 		std::cerr << "Falha ao inicializar GLAD" << std::endl;
 		return -1;
@@ -85,10 +91,10 @@ int main()
 	cout << "OpenGL version supported " << version << endl;
 
 	// Compilando e buildando o programa de shader
-	GLuint shaderID = setupShader();
+	GLuint shaderID = PROFILE_PHASE("setupShader", setupShader());
 
 	// Buffer com geometria (triângulo grande em coordenadas de tela)
-	GLuint VAO = setupGeometry();
+	GLuint VAO = PROFILE_PHASE("setupGeometry", setupGeometry());
 
 	glUseProgram(shaderID);
 
@@ -116,14 +122,15 @@ int main()
 		glDrawArrays(GL_TRIANGLES, 0, 3);
 		glBindVertexArray(0);
 
+		regressionFrame(window);
 		// Troca os buffers da tela
-		glfwSwapBuffers(window);
+		PROFILE_FIRST_FRAME(glfwSwapBuffers(window));
 	}
 
 	// Desaloca os buffers e encerra
 	glDeleteVertexArrays(1, &VAO);
 	glfwTerminate();
-	return 0;
+	return regressionResult();
 }
 
 // Função de callback de teclado
@@ -10,6 +10,12 @@ using namespace std;
 // GLFW
 #include <GLFW/glfw3.h>
 
+#include "GLLoader.h"
+#include "GpuTimer.h"
+#include "Regression.h"
+#include "ShaderLibrary.h"
+#include "StartupProfiler.h"
+
 // GLM
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
@@ -21,13 +27,13 @@ using namespace glm;
 void key_callback(GLFWwindow *window, int key, int scancode, int action, int mode);
 
 // Protótipos das funções
-int setupShader();
 int setupGeometry();
 
 // Dimensões da janela (pode ser alterado em tempo de execução)
 const GLuint WIDTH = 800, HEIGHT = 600;
 
-// Código fonte do Vertex Shader (em GLSL)
+// Código fonte do Vertex Shader (em GLSL): o que vale é assets/shaders/lista2_cor.vert;
+// este texto só é usado se o arquivo não for encontrado
 const GLchar *vertexShaderSource = R"(
  #version 400
  layout (location = 0) in vec3 position;
@@ -41,7 +47,7 @@ const GLchar *vertexShaderSource = R"(
  }
  )";
 
-// Código fonte do Fragment Shader (em GLSL)
+// Código fonte do Fragment Shader (em GLSL), reserva de assets/shaders/lista2_cor.frag
 const GLchar *fragmentShaderSource = R"(
  #version 400
  in vec3 vColor;
@@ -56,10 +62,12 @@ const GLchar *fragmentShaderSource = R"(
 int main()
 {
 	// Inicialização da GLFW
-	glfwInit();
+	PROFILE_PHASE("glfwInit", glfwInit());
+
+	regressionInit("Lista2_Exercicio5");
 
 	// Criação da janela GLFW
-	GLFWwindow *window = glfwCreateWindow(WIDTH, HEIGHT, "Viewport: Quadrante Superior Direito", nullptr, nullptr);
+	GLFWwindow *window = PROFILE_PHASE("glfwCreateWindow", glfwCreateWindow(WIDTH, HEIGHT, "Viewport: Quadrante Superior Direito", nullptr, nullptr));
 	if (!window)
 	{
 		std::cerr << "Falha ao criar a janela GLFW" << std::endl;
@@ -72,7 +80,7 @@ int main()
 	glfwSetKeyCallback(window, key_callback);
 
 	// GLAD: carrega ponteiros das funções da OpenGL
-	if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+	if (!PROFILE_PHASE("loadGL", loadGL((GLADloadproc)glfwGetProcAddress)))
 	{
 		std::cerr << "Falha ao inicializar GLAD" << std::endl;
 		return -1;
@@ -84,11 +92,18 @@ int main()
 	cout << "Renderer: " << renderer << endl;
 	cout << "OpenGL version supported " << version << endl;
 
-	// Compilando e buildando o programa de shader
-	GLuint shaderID = setupShader();
+	// Shaders lidos de arquivo e compilados sem bloquear; editar o arquivo com o
+	// programa aberto recarrega o shader (FCG_SHADER_COMPILE=khr|thread|sync)
+	ShaderLibrary shaders;
+	shaders.init(window);
+	ShaderLibrary::Handle colorShader = shaders.load("assets/shaders/lista2_cor.vert", "assets/shaders/lista2_cor.frag",
+	                                                 vertexShaderSource, fragmentShaderSource);
+
+	// Buffer com geometria (triângulo grande em coordenadas de tela), enquanto o shader compila
+	GLuint VAO = PROFILE_PHASE("setupGeometry", setupGeometry());
 
-	// Buffer com geometria (triângulo grande em coordenadas de tela)
-	GLuint VAO = setupGeometry();
+	PROFILE_PHASE("setupShader", shaders.waitAll());
+	GLuint shaderID = shaders.program(colorShader);
 
 	glUseProgram(shaderID);
 
@@ -97,14 +112,23 @@ int main()
 	glUniformMatrix4fv(glGetUniformLocation(shaderID, "projection"), 1, GL_FALSE, value_ptr(projection));
 
 	// Loop principal
+	// Tempo de GPU por viewport, lido alguns quadros depois
+	GpuTimer gpu;
+
 	while (!glfwWindowShouldClose(window))
 	{
 		// Eventos
 		glfwPollEvents();
+		shaders.update();
+		shaderID = shaders.program(colorShader);
+		glUseProgram(shaderID);
+		gpu.beginFrame();
 
 		// Limpa o buffer de cor
+		gpu.begin("limpa");
 		glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
 		glClear(GL_COLOR_BUFFER_BIT);
+		gpu.end();
 
 		// Configura quatro viewports (quatro cantos) e desenha a cena em cada um
 		int width, height;
@@ -117,32 +141,48 @@ int main()
 		}
 
 		// Inferior esquerdo
+		gpu.begin("viewport_inf_esq");
 		glViewport(0, 0, width / 2, height / 2);
 		glBindVertexArray(VAO);
 		glDrawArrays(GL_TRIANGLES, 0, 3);
+		gpu.end();
 
 		// Inferior direito
+		gpu.begin("viewport_inf_dir");
 		glViewport(width / 2, 0, width / 2, height / 2);
 		glDrawArrays(GL_TRIANGLES, 0, 3);
+		gpu.end();
 
 		// Superior esquerdo
+		gpu.begin("viewport_sup_esq");
 		glViewport(0, height / 2, width / 2, height / 2);
 		glDrawArrays(GL_TRIANGLES, 0, 3);
+		gpu.end();
 
 		// Superior direito
+		gpu.begin("viewport_sup_dir");
 		glViewport(width / 2, height / 2, width / 2, height / 2);
 		glDrawArrays(GL_TRIANGLES, 0, 3);
+		gpu.end();
 
 		glBindVertexArray(0);
+		gpu.endFrame();
 
+		regressionFrame(window);
 		// Troca os buffers da tela
-		glfwSwapBuffers(window);
+		PROFILE_FIRST_FRAME(glfwSwapBuffers(window));
 	}
 
+	gpu.finish();
+	if (regressionEnabled())
+		gpu.appendCsv(regressionEnv("FCG_GPU_RESULTS", "regressao_gpu.csv"), "Lista2_Exercicio5");
+	gpu.release();
+
 	// Desaloca os buffers e encerra
 	glDeleteVertexArrays(1, &VAO);
+	shaders.release();
 	glfwTerminate();
-	return 0;
+	return regressionResult();
 }
 
 // Função de callback de teclado
@@ -152,54 +192,6 @@ void key_callback(GLFWwindow *window, int key, int scancode, int action, int mod
 		glfwSetWindowShouldClose(window, GL_TRUE);
 }
 
-// Função para configurar os shaders
-int setupShader()
-{
-	// Vertex shader
-	GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
-	glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
-	glCompileShader(vertexShader);
-
-	GLint success;
-	GLchar infoLog[512];
-	glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
-	if (!success)
-	{
-		glGetShaderInfoLog(vertexShader, 512, NULL, infoLog);
-		std::cout << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n" << infoLog << std::endl;
-	}
-
-	// Fragment shader
-	GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-	glShaderSource(fragmentShader, 1, &fragmentShaderSource, NULL);
-	glCompileShader(fragmentShader);
-
-	glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &success);
-	if (!success)
-	{
-		glGetShaderInfoLog(fragmentShader, 512, NULL, infoLog);
-		std::cout << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n" << infoLog << std::endl;
-	}
-
-	// Linkando os shaders
-	GLuint shaderProgram = glCreateProgram();
-	glAttachShader(shaderProgram, vertexShader);
-	glAttachShader(shaderProgram, fragmentShader);
-	glLinkProgram(shaderProgram);
-
-	glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
-	if (!success)
-	{
-		glGetProgramInfoLog(shaderProgram, 512, NULL, infoLog);
-		std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n" << infoLog << std::endl;
-	}
-
-	glDeleteShader(vertexShader);
-	glDeleteShader(fragmentShader);
-
-	return shaderProgram;
-}
-
 int setupGeometry()
 {
 	GLfloat vertices[] = {
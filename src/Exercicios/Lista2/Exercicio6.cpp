@@ -1,7 +1,12 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <iostream>
 #include <string>
 #include <vector>
 #include <random>
+#include <cstdio>
+#include <cstdlib>
 #include <assert.h>
 
 using namespace std;
@@ -12,6 +17,20 @@ using namespace std;
 // GLFW
 #include <GLFW/glfw3.h>
 
+#include "AntiAlias.h"
+#include "Camera2D.h"
+#include "Color.h"
+#include "GLLoader.h"
+#include "Random.h"
+#include "Regression.h"
+#include "SceneJournal.h"
+#include "StartupProfiler.h"
+#include "TilePyramid.h"
+#include "Trace.h"
+#include "TriangleSlots.h"
+#include "TriangleStress.h"
+#include "WeightedOIT.h"
+
 // GLM
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
@@ -22,48 +41,186 @@ using namespace glm;
 // Protótipos
 void key_callback(GLFWwindow *window, int key, int scancode, int action, int mode);
 void mouse_button_callback(GLFWwindow* window, int button, int action, int mods);
+void cursor_pos_callback(GLFWwindow *window, double xpos, double ypos);
+void scroll_callback(GLFWwindow *window, double xoffset, double yoffset);
 int setupShader();
 int setupGeometry();
 
 // Dimensões iniciais da janela
 const GLuint WIDTH = 800, HEIGHT = 600;
 
-// Shaders
+// Shaders: a cor de cada triângulo vem no vértice, então um glMultiDrawArrays desenha todos.
+// O z do vértice (slotDepth, já em NDC) mantém a ordem de criação entre baldes
 const GLchar *vertexShaderSource = R"(
  #version 400
  layout (location = 0) in vec3 position;
+ layout (location = 1) in vec4 vertexColor;
  uniform mat4 projection;
+ out vec4 vColor;
  void main()
  {
-     gl_Position = projection * vec4(position, 1.0);
+     vColor = vertexColor;
+     gl_Position = projection * vec4(position.xy, 0.0, 1.0);
+     gl_Position.z = position.z;
  }
 )";
 
 const GLchar *fragmentShaderSource = R"(
  #version 400
- uniform vec4 inputColor;
+ in vec4 vColor;
  out vec4 color;
  void main()
  {
-     color = inputColor;
+     color = vColor;
  }
 )";
 
 // Estado global simples
 static vector<vec3> g_pending;           // vértices clicados ainda não formaram um triângulo
-static vector<vec3> g_vertices;          // todos os vértices dos triângulos formados (múltiplos de 3)
-static vector<vec4> g_colors;            // uma cor por triângulo
-static GLuint gVBO = 0;
+static TriangleSlots g_slots;            // triângulos formados: VBO, cor e id estável de cada um
+static uint32_t g_nextId = 0;
+static SceneJournal g_journal;           // FCG_JOURNAL=prefixo: edições gravadas em disco
+static bool g_journalOn = false;
+static Xoshiro128 g_rng;                 // cores aleatórias (FCG_SEED fixa a sequência)
+static TriangleStress g_stress;          // FCG_STRESS: triângulos sintéticos a uma taxa fixa
+static vector<SceneRecord> g_stressBatch;
 static GLuint gVAO = 0;
+static Camera2D g_camera;                // roda: zoom no cursor; botão do meio: arrasta; setas, +/- e 0
+static bool g_panning = false;
+static double g_panX = 0.0, g_panY = 0.0;
+static bool g_oit = false;               // FCG_OIT=1: triângulos semitransparentes, sem ordenação
+static TilePyramid g_tiles;              // de longe, a cena vem de tiles em vez dos triângulos
+
+// Cor aleatória em RGBA8 (alpha 1, ou entre 0.35 e 0.75 no modo OIT), o formato do VBO e do diário
+static uint32_t randomColor()
+{
+    float r = g_rng.uniform(0.2f, 1.0f), g = g_rng.uniform(0.2f, 1.0f), b = g_rng.uniform(0.2f, 1.0f);
+    return canvasColor(r, g, b, g_oit ? g_rng.uniform(0.35f, 0.75f) : 1.0f);
+}
+
+static void addTriangle(const SceneRecord &r)
+{
+    g_slots.add(r.id, r.xy, r.color);
+    g_tiles.invalidate(r.xy);
+    g_nextId = std::max(g_nextId, r.id + 1);
+}
+
+// Edições de um slot passam por aqui para sujar os tiles que o cobrem
+static void touchTiles(size_t slot)
+{
+    const SlotVertex *v = g_slots.vertices(slot);
+    const float xy[6] = {v[0].x, v[0].y, v[1].x, v[1].y, v[2].x, v[2].y};
+    g_tiles.invalidate(xy);
+}
+
+static void removeTriangle(size_t slot)
+{
+    touchTiles(slot);
+    g_slots.remove(slot);
+}
+
+static void recolorTriangle(size_t slot, uint32_t color)
+{
+    touchTiles(slot);
+    g_slots.setColor(slot, color);
+}
+
+// Posição do cursor no mundo
+static void cursorWorld(GLFWwindow *window, float &wx, float &wy)
+{
+    double xpos, ypos;
+    glfwGetCursorPos(window, &xpos, &ypos);
+    g_camera.toWorld(static_cast<float>(xpos), static_cast<float>(ypos), wx, wy);
+}
+
+// Reaplica uma edição lida do diário
+static void applyOp(const SceneOp &op)
+{
+    long i;
+    switch (op.type)
+    {
+    case SCENE_OP_ADD:
+        addTriangle(op.record);
+        break;
+    case SCENE_OP_DELETE:
+        if ((i = g_slots.find(op.record.id)) >= 0)
+            removeTriangle(static_cast<size_t>(i));
+        break;
+    case SCENE_OP_RECOLOR:
+        if ((i = g_slots.find(op.record.id)) >= 0)
+            recolorTriangle(static_cast<size_t>(i), op.record.color);
+        break;
+    }
+}
+
+// Cena atual no formato do snapshot
+static vector<SceneRecord> sceneRecords()
+{
+    vector<SceneRecord> records;
+    records.reserve(g_slots.live());
+    for (size_t i = 0; i < g_slots.slots(); ++i)
+    {
+        if (!g_slots.alive(i))
+            continue;
+        SceneRecord r;
+        r.id = g_slots.id(i);
+        r.color = g_slots.color(i);
+        const SlotVertex *v = g_slots.vertices(i);
+        for (int k = 0; k < 3; ++k)
+        {
+            r.xy[2 * k] = v[k].x;
+            r.xy[2 * k + 1] = v[k].y;
+        }
+        records.push_back(r);
+    }
+    return records;
+}
 
 // Função principal
 int main()
 {
     // Inicialização da GLFW
-    glfwInit();
+    PROFILE_PHASE("glfwInit", glfwInit());
+
+    const char *oitEnv = getenv("FCG_OIT");
+    g_oit = oitEnv && oitEnv[0] == '1';
+    // O antisserrilhado analítico troca o programa, e o OIT também: os dois
+    // juntos não combinam, então o OIT vence e o AA fica desligado
+    AAMode aaMode = aaModeFromEnv();
+    if (g_oit && aaMode == AAMode::Analytic)
+    {
+        std::cerr << "FCG_OIT=1 não combina com FCG_AA=analitico; antisserrilhado desligado" << std::endl;
+        aaMode = AAMode::None;
+    }
+    std::string regressionName = "Lista2_Exercicio6";
+    if (aaMode != AAMode::None)
+        regressionName += std::string("_") + aaModeName(aaMode);
+    regressionInit((regressionName + (g_oit ? "_oit" : "")).c_str());
+
+    // Uma semente por execução (ou FCG_SEED), em vez de um random_device por triângulo
+    const char *seedEnv = getenv("FCG_SEED");
+    g_rng.reseed(seedEnv ? strtoull(seedEnv, nullptr, 10) : std::random_device{}());
+    g_stress.init(stressConfigFromEnv());
+
+    // Apagar deixa buracos; no modo OIT a ordem não importa e o próximo triângulo ocupa o buraco
+    g_slots.reuseSlots = g_oit;
+    g_tiles.depthOrder = !g_oit;
+    if (const char *compactEnv = getenv("FCG_COMPACT_THRESHOLD"))
+        g_slots.compactThreshold = static_cast<float>(atof(compactEnv));
+    if (const char *bucketEnv = getenv("FCG_BUCKET_SIZE"))
+        g_slots.cellSize = static_cast<float>(atof(bucketEnv));
+    // FCG_TILES=0 desliga a pirâmide de tiles; FCG_TILES_ZOOM é o zoom a partir do qual ela entra
+    if (const char *tilesEnv = getenv("FCG_TILES"))
+        g_tiles.enabled = tilesEnv[0] != '0';
+    if (const char *zoomEnv = getenv("FCG_TILES_ZOOM"))
+        g_tiles.maxZoom = static_cast<float>(atof(zoomEnv));
+    if (const char *maxEnv = getenv("FCG_TILES_MAX"))
+        g_tiles.maxTiles = static_cast<size_t>(atol(maxEnv));
+    if (const char *budgetEnv = getenv("FCG_TILES_BUDGET"))
+        g_tiles.buildBudget = static_cast<size_t>(atol(budgetEnv));
 
     // Criação da janela
-    GLFWwindow *window = glfwCreateWindow(WIDTH, HEIGHT, "Exercicio6 - Clique para criar triangulos", nullptr, nullptr);
+    GLFWwindow *window = PROFILE_PHASE("glfwCreateWindow", glfwCreateWindow(WIDTH, HEIGHT, "Exercicio6 - Clique para criar triangulos", nullptr, nullptr));
     if (!window)
     {
         std::cerr << "Falha ao criar a janela GLFW" << std::endl;
@@ -75,9 +232,11 @@ int main()
     // Callbacks
     glfwSetKeyCallback(window, key_callback);
     glfwSetMouseButtonCallback(window, mouse_button_callback);
+    glfwSetCursorPosCallback(window, cursor_pos_callback);
+    glfwSetScrollCallback(window, scroll_callback);
 
     // GLAD
-    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+    if (!PROFILE_PHASE("loadGL", loadGL((GLADloadproc)glfwGetProcAddress)))
     {
         std::cerr << "Falha ao inicializar GLAD" << std::endl;
         return -1;
@@ -90,95 +249,323 @@ int main()
     cout << "OpenGL version supported " << version << endl;
 
     // Shaders
-    GLuint shaderID = setupShader();
+    GLuint shaderID = PROFILE_PHASE("setupShader", setupShader());
+
+    // FCG_AA escolhe o antisserrilhado; o analítico troca o programa
+    AntiAliasing aa(aaMode);
+    if (aa.mode() == AAMode::Analytic)
+    {
+        glDeleteProgram(shaderID);
+        shaderID = aa.analyticProgram(vertexShaderSource, true);
+    }
+
+    // No modo OIT os triângulos vão para os alvos de acumulação com o programa do WeightedOIT
+    WeightedOIT oit;
+    if (g_oit)
+    {
+        glDeleteProgram(shaderID);
+        shaderID = oit.init(vertexShaderSource, true);
+    }
     glUseProgram(shaderID);
+    glDepthFunc(GL_LEQUAL); // mesmo z (ids a partir de 2^23): vale a ordem de desenho
 
     // Geometria (VAO/VBO)
-    gVAO = setupGeometry();
+    gVAO = PROFILE_PHASE("setupGeometry", setupGeometry());
+    if (g_tiles.enabled && !g_tiles.init())
+        g_tiles.enabled = false;
+
+    // FCG_JOURNAL=prefixo: recupera a sessão anterior (snapshot + diário) e grava as edições
+    if (const char *journalEnv = getenv("FCG_JOURNAL"))
+    {
+        const char *compactEnv = getenv("FCG_JOURNAL_COMPACT");
+        if (compactEnv)
+            g_journal.compactEvery = static_cast<size_t>(atol(compactEnv));
+        g_journalOn = g_journal.open(
+            journalEnv,
+            [](const SceneRecord *records, size_t count) {
+                g_slots.reserve(count);
+                for (size_t i = 0; i < count; ++i)
+                    addTriangle(records[i]);
+            },
+            applyOp);
+        g_nextId = std::max(g_nextId, g_journal.snapshotNextId());
+        cout << "Diario " << journalEnv << ": " << g_journal.snapshotRecords() << " triangulos do snapshot + "
+             << g_journal.replayedOps() << " edicoes em " << g_journal.openMs() << " ms" << endl;
+    }
 
     // Locais de uniforms
     GLint projLoc = glGetUniformLocation(shaderID, "projection");
-    GLint colorLoc = glGetUniformLocation(shaderID, "inputColor");
+
+    double prevTime = glfwGetTime(), reportTime = prevTime;
+    uint64_t reportGenerated = 0, reportFrames = 0, reportBytes = 0;
+    vector<GLint> drawFirst;
+    vector<GLsizei> drawCount;
 
     // Loop principal
     while (!glfwWindowShouldClose(window))
     {
+        TRACE_SCOPE("quadro");
+
         // Eventos
-        glfwPollEvents();
+        {
+            TRACE_SCOPE("poll");
+            glfwPollEvents();
+        }
+
+        int fbw, fbh;
+        glfwGetFramebufferSize(window, &fbw, &fbh);
+        aa.beginFrame(fbw, fbh);
 
         // Limpa tela
         glClearColor(0.05f, 0.05f, 0.08f, 1.0f);
-        glClear(GL_COLOR_BUFFER_BIT);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-        int fbw, fbh;
-        glfwGetFramebufferSize(window, &fbw, &fbh);
-        mat4 projection = ortho(0.0, static_cast<double>(fbw), static_cast<double>(fbh), 0.0, -1.0, 1.0);
+        // Câmera: sem pan nem zoom, o mundo coincide com os pixels da janela
+        mat4 projection = ortho(g_camera.left(), g_camera.right(fbw), g_camera.bottom(fbh), g_camera.top(), -1.0f, 1.0f);
         glUniformMatrix4fv(projLoc, 1, GL_FALSE, value_ptr(projection));
 
-        glBindBuffer(GL_ARRAY_BUFFER, gVBO);
-        if (!g_vertices.empty())
+        // FCG_STRESS: os triângulos sintéticos entram pelo mesmo caminho dos cliques
+        if (g_stress.enabled())
         {
-            glBufferData(GL_ARRAY_BUFFER, g_vertices.size() * sizeof(vec3), g_vertices.data(), GL_DYNAMIC_DRAW);
+            TRACE_SCOPE("stress");
+            double now = glfwGetTime();
+            size_t n = g_stress.due(now - prevTime, g_slots.live());
+            prevTime = now;
+            if (n > 0)
+            {
+                g_stressBatch.resize(n);
+                const StressConfig &cfg = g_stress.config();
+                g_stress.generate(g_stressBatch.data(), n, cfg.canvasWidth > 0 ? cfg.canvasWidth : static_cast<float>(fbw),
+                                  cfg.canvasHeight > 0 ? cfg.canvasHeight : static_cast<float>(fbh), g_nextId,
+                                  g_oit ? 0.35f : 1.0f, g_oit ? 0.75f : 1.0f);
+                for (const SceneRecord &r : g_stressBatch)
+                    addTriangle(r);
+                if (g_journalOn)
+                    for (const SceneRecord &r : g_stressBatch)
+                        g_journal.add(r);
+            }
+            // FCG_STRESS_DELETE: apaga slots sorteados pelo gerador (um buraco sorteado
+            // conta como tentativa); mesma semente, mesmas remoções
+            for (size_t d = g_stress.deletions(n); d > 0 && g_slots.live() > 0; --d)
+            {
+                size_t slot = g_stress.victim(g_slots.slots());
+                if (!g_slots.alive(slot))
+                    continue;
+                if (g_journalOn)
+                    g_journal.remove(g_slots.id(slot));
+                removeTriangle(slot);
+            }
+        }
+
+        {
+            TRACE_SCOPE("upload");
+            // Só as faixas que mudaram desde o último quadro (e um pedaço da compactação)
+            g_slots.compactStep();
+            reportBytes += g_slots.upload();
+        }
+
+        // De longe (zoom <= FCG_TILES_ZOOM) a tela sai da pirâmide de tiles
+        {
+            TRACE_SCOPE("tiles");
+            g_tiles.update(g_camera.left(), g_camera.top(), g_camera.right(fbw), g_camera.bottom(fbh), g_camera.zoom,
+                           gVAO, [](float x0, float y0, float x1, float y1, vector<GLint> &first, vector<GLsizei> &count) {
+                               g_slots.visibleRanges(x0, y0, x1, y1, first, count);
+                           });
+        }
+        bool tiled = g_tiles.active(g_camera.zoom);
+
+        // Senão, só os baldes que tocam a área visível, em poucas faixas contíguas
+        size_t visibleBuckets = 0;
+        drawFirst.clear();
+        drawCount.clear();
+        if (tiled)
+        {
+            TRACE_SCOPE("draw");
+            g_tiles.draw(value_ptr(projection));
         }
         else
         {
-            glBufferData(GL_ARRAY_BUFFER, 0, nullptr, GL_DYNAMIC_DRAW);
+            TRACE_SCOPE("draw");
+            visibleBuckets = g_slots.visibleRanges(g_camera.left(), g_camera.top(), g_camera.right(fbw),
+                                                   g_camera.bottom(fbh), drawFirst, drawCount);
+            // Opacos: o teste de profundidade põe o mais novo por cima, qualquer que
+            // seja a ordem dos baldes. O OIT não depende da ordem e dispensa o teste
+            if (g_oit)
+                oit.begin(fbw, fbh);
+            else
+                glEnable(GL_DEPTH_TEST);
+            glBindVertexArray(gVAO);
+            if (!drawFirst.empty())
+                glMultiDrawArrays(GL_TRIANGLES, drawFirst.data(), drawCount.data(), static_cast<GLsizei>(drawFirst.size()));
+            glBindVertexArray(0);
+            if (g_oit)
+                oit.end();
+            else
+                glDisable(GL_DEPTH_TEST);
+        }
+        aa.endFrame();
+
+        if (g_stress.enabled())
+        {
+            double now = glfwGetTime();
+            ++reportFrames;
+            if (now - reportTime >= 1.0)
+            {
+                size_t drawn = 0;
+                for (GLsizei c : drawCount)
+                    drawn += static_cast<size_t>(c) / 3;
+                char view[96], title[320];
+                if (tiled)
+                    snprintf(view, sizeof(view), "%zu tiles no nivel %d (%zu refeitos, %zu em cache)",
+                             g_tiles.visibleTiles(), g_tiles.level(), g_tiles.builtTiles(), g_tiles.cachedTiles());
+                else
+                    snprintf(view, sizeof(view), "baldes %zu/%zu, %zu slots desenhados", visibleBuckets,
+                             g_slots.bucketCount(), drawn);
+                snprintf(title, sizeof(title),
+                         "Exercicio6 - %zu triangulos (%zu buracos), %.0f novos/s, %.2f ms/quadro, %.0f KB/quadro, %s",
+                         g_slots.live(), g_slots.holes(), (g_stress.generated() - reportGenerated) / (now - reportTime),
+                         1000.0 * (now - reportTime) / reportFrames, reportBytes / 1024.0 / reportFrames, view);
+                glfwSetWindowTitle(window, title);
+                reportTime = now;
+                reportGenerated = g_stress.generated();
+                reportFrames = 0;
+                reportBytes = 0;
+            }
         }
 
-        // Desenha cada triângulo com sua cor aleatória
-        glBindVertexArray(gVAO);
-        size_t triCount = g_vertices.size() / 3;
-        for (size_t i = 0; i < triCount; ++i)
+        if (g_journalOn)
         {
-            const vec4& c = g_colors[i];
-            glUniform4f(colorLoc, c.r, c.g, c.b, c.a);
-            glDrawArrays(GL_TRIANGLES, static_cast<GLint>(i * 3), 3);
+            TRACE_SCOPE("journal");
+            g_journal.flush();
+            if (g_journal.wantsSnapshot())
+                g_journal.snapshot(sceneRecords(), g_nextId);
         }
-        glBindVertexArray(0);
 
-        glfwSwapBuffers(window);
+        regressionFrame(window);
+        {
+            TRACE_SCOPE("swap");
+            PROFILE_FIRST_FRAME(glfwSwapBuffers(window));
+        }
     }
 
+    if (g_stress.enabled())
+        cout << "Stress: " << g_stress.generated() << " triangulos gerados, " << g_slots.live() << " na cena, "
+             << g_slots.compactionCount() << " compactacoes" << endl;
+
     // Libera recursos
+    g_journal.close();
     if (gVAO) glDeleteVertexArrays(1, &gVAO);
-    if (gVBO) glDeleteBuffers(1, &gVBO);
+    g_slots.release();
+    g_tiles.release();
+    aa.release();
+    oit.release();
     glfwTerminate();
-    return 0;
+    return regressionResult();
 }
 
-// Callback de teclado
+// Callback de teclado: C troca a cor do triângulo sob o cursor; setas movem a câmera, +/- dão
+// zoom no centro e 0 volta ao enquadramento inicial
 void key_callback(GLFWwindow *window, int key, int scancode, int action, int mode)
 {
     if (key == GLFW_KEY_ESCAPE && action == GLFW_PRESS)
         glfwSetWindowShouldClose(window, GL_TRUE);
+    if (action != GLFW_PRESS && action != GLFW_REPEAT)
+        return;
+    int w, h;
+    glfwGetFramebufferSize(window, &w, &h);
+    if (key == GLFW_KEY_C && action == GLFW_PRESS)
+    {
+        float wx, wy;
+        cursorWorld(window, wx, wy);
+        long i = g_slots.pick(wx, wy);
+        if (i >= 0)
+        {
+            uint32_t color = randomColor();
+            recolorTriangle(static_cast<size_t>(i), color);
+            if (g_journalOn)
+                g_journal.recolor(g_slots.id(i), color);
+        }
+    }
+    else if (key == GLFW_KEY_LEFT)
+        g_camera.pan(0.1f * w, 0.0f);
+    else if (key == GLFW_KEY_RIGHT)
+        g_camera.pan(-0.1f * w, 0.0f);
+    else if (key == GLFW_KEY_UP)
+        g_camera.pan(0.0f, 0.1f * h);
+    else if (key == GLFW_KEY_DOWN)
+        g_camera.pan(0.0f, -0.1f * h);
+    else if (key == GLFW_KEY_EQUAL || key == GLFW_KEY_KP_ADD)
+        g_camera.zoomAt(1.25f, 0.5f * w, 0.5f * h);
+    else if (key == GLFW_KEY_MINUS || key == GLFW_KEY_KP_SUBTRACT)
+        g_camera.zoomAt(0.8f, 0.5f * w, 0.5f * h);
+    else if (key == GLFW_KEY_0)
+        g_camera.reset();
 }
 
-// Callback de mouse: cada clique esquerdo adiciona um vértice; a cada 3 cliques, forma um triângulo com cor aleatória
+// Callback de mouse: cada clique esquerdo adiciona um vértice; a cada 3 cliques, forma um triângulo com cor aleatória.
+// O clique direito apaga o triângulo sob o cursor; o botão do meio arrasta a câmera.
 void mouse_button_callback(GLFWwindow* window, int button, int action, int mods)
 {
-    if (button == GLFW_MOUSE_BUTTON_LEFT && action == GLFW_PRESS)
+    TRACE_SCOPE("mouse_button_callback");
+    if (button == GLFW_MOUSE_BUTTON_MIDDLE)
     {
-        double xpos, ypos;
-        glfwGetCursorPos(window, &xpos, &ypos);
-        g_pending.emplace_back(static_cast<float>(xpos), static_cast<float>(ypos), 0.0f);
+        g_panning = action == GLFW_PRESS;
+        glfwGetCursorPos(window, &g_panX, &g_panY);
+        return;
+    }
+    if (action != GLFW_PRESS)
+        return;
+    float wx, wy;
+    cursorWorld(window, wx, wy);
+    if (button == GLFW_MOUSE_BUTTON_LEFT)
+    {
+        g_pending.emplace_back(wx, wy, 0.0f);
 
         if (g_pending.size() == 3)
         {
             // Move vértices pendentes para a lista definitiva
-            g_vertices.push_back(g_pending[0]);
-            g_vertices.push_back(g_pending[1]);
-            g_vertices.push_back(g_pending[2]);
-
-            // Gera cor aleatória (alpha 1)
-            std::random_device rd;
-            std::mt19937 gen(rd());
-            std::uniform_real_distribution<float> dist(0.2f, 1.0f);
-            vec4 color(dist(gen), dist(gen), dist(gen), 1.0f);
-            g_colors.push_back(color);
+            SceneRecord r;
+            r.id = g_nextId;
+            r.color = randomColor();
+            for (int v = 0; v < 3; ++v)
+            {
+                r.xy[2 * v] = g_pending[v].x;
+                r.xy[2 * v + 1] = g_pending[v].y;
+            }
+            addTriangle(r);
+            if (g_journalOn)
+                g_journal.add(r);
 
             g_pending.clear();
         }
     }
+    else if (button == GLFW_MOUSE_BUTTON_RIGHT)
+    {
+        long i = g_slots.pick(wx, wy);
+        if (i >= 0)
+        {
+            if (g_journalOn)
+                g_journal.remove(g_slots.id(i));
+            removeTriangle(static_cast<size_t>(i));
+        }
+    }
+}
+
+void cursor_pos_callback(GLFWwindow *window, double xpos, double ypos)
+{
+    if (!g_panning)
+        return;
+    g_camera.pan(static_cast<float>(xpos - g_panX), static_cast<float>(ypos - g_panY));
+    g_panX = xpos;
+    g_panY = ypos;
+}
+
+// Roda do mouse: zoom mantendo fixo o ponto sob o cursor
+void scroll_callback(GLFWwindow *window, double xoffset, double yoffset)
+{
+    double xpos, ypos;
+    glfwGetCursorPos(window, &xpos, &ypos);
+    g_camera.zoomAt(std::pow(1.15f, static_cast<float>(yoffset)), static_cast<float>(xpos), static_cast<float>(ypos));
 }
 
 // Compila e linka shaders
@@ -231,15 +618,16 @@ int setupShader()
 
 int setupGeometry()
 {
-    glGenBuffers(1, &gVBO);
-    glBindBuffer(GL_ARRAY_BUFFER, gVBO);
-    glBufferData(GL_ARRAY_BUFFER, 0, nullptr, GL_DYNAMIC_DRAW);
+    g_slots.init();
+    glBindBuffer(GL_ARRAY_BUFFER, g_slots.buffer());
 
     glGenVertexArrays(1, &gVAO);
     glBindVertexArray(gVAO);
 
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(vec3), (GLvoid*)0);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(SlotVertex), (GLvoid*)0);
     glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(SlotVertex), (GLvoid*)offsetof(SlotVertex, color));
+    glEnableVertexAttribArray(1);
 
     glBindBuffer(GL_ARRAY_BUFFER, 0);
     glBindVertexArray(0);
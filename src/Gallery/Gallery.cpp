@@ -0,0 +1,175 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include "Geometry.h"
+#include "Regression.h"
+#include "ShaderProgram.h"
+#include "WindowGroup.h"
+
+// Galeria: as formas da lista 1 (Exercicio6 a 6e e a espiral do 7), cada uma
+// numa janela, num processo só. O programa e os VBOs são criados uma vez no
+// contexto da primeira janela e compartilhados; cada janela só cria os seus
+// VAOs. Ao abrir, cada janela mostra quanto custou até o primeiro quadro: a
+// primeira paga glfwInit, carregador, shaders e upload, as outras só a janela.
+//
+// FCG_GALLERY_WINDOWS=n abre só as n primeiras formas. Fechar a primeira
+// janela encerra a galeria.
+
+const int WIN_SIZE = 320;
+
+const GLchar *vsSrc = R"(
+#version 400
+layout (location = 0) in vec3 position;
+void main() { gl_Position = vec4(position, 1.0); }
+)";
+
+const GLchar *fsSrc = R"(
+#version 400
+uniform vec4 inputColor;
+out vec4 color;
+void main() { color = inputColor; }
+)";
+
+struct Shape
+{
+    const char *title;
+    GLenum mode;
+    float r, g, b;
+    vector<GLfloat> vertices;
+    GLuint vbo = 0;
+};
+
+// Mesmos parâmetros dos exercícios, pelos geradores de Geometry.h
+static vector<Shape> makeShapes()
+{
+    vector<Shape> shapes;
+    auto fan = [&](const char *title, int count, int segments, double start, float r, float g, float b) {
+        Shape s{title, GL_TRIANGLES, r, g, b, {}};
+        s.vertices.resize(count * 9);
+        circleFan(s.vertices.data(), count, segments, 0.0f, 0.0f, 0.5f, start);
+        shapes.push_back(s);
+    };
+    fan("Lista1_Exercicio6", 100, 100, 0.0, 1.0f, 0.0f, 0.0f);
+    fan("Lista1_Exercicio6a", 8, 8, 0.0, 1.0f, 0.0f, 0.0f);
+    fan("Lista1_Exercicio6b", 5, 5, 0.0, 1.0f, 0.0f, 0.0f);
+    fan("Lista1_Exercicio6c", 82, 100, M_PI / 5.0f, 1.0f, 1.0f, 0.0f);
+    fan("Lista1_Exercicio6d", 18, 100, -0.4, 1.0f, 1.0f, 0.0f);
+
+    Shape star{"Lista1_Exercicio6e", GL_TRIANGLES, 1.0f, 0.0f, 0.0f, {}};
+    star.vertices.resize(5 * 18);
+    starFan(star.vertices.data(), 5, 0.0f, 0.0f, 0.5f, 0.18f, 4.08);
+    shapes.push_back(star);
+
+    Shape spiralShape{"Lista1_Exercicio7", GL_LINE_STRIP, 1.0f, 0.0f, 0.0f, {}};
+    spiralShape.vertices.resize(190 * 3);
+    spiral(spiralShape.vertices.data(), 190, 0.0f, 0.0f, 0.0f, 0.02f, 0.1f);
+    shapes.push_back(spiralShape);
+    return shapes;
+}
+
+// ESC fecha a janela (a primeira fecha a galeria)
+static void key_callback(GLFWwindow *window, int key, int scancode, int action, int mode)
+{
+    if (key == GLFW_KEY_ESCAPE && action == GLFW_PRESS)
+        glfwSetWindowShouldClose(window, GL_TRUE);
+}
+
+static void drawShape(WindowGroup &group, size_t i, const Shape &s, GLuint prog, GLint colorLoc)
+{
+    int w, h;
+    glfwGetFramebufferSize(group.window(i), &w, &h);
+    glViewport(0, 0, w, h);
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glUseProgram(prog);
+    glUniform4f(colorLoc, s.r, s.g, s.b, 1.0f);
+    glBindVertexArray(group.vertexArray(i, 0, [&] {
+        glBindBuffer(GL_ARRAY_BUFFER, s.vbo);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(GLfloat), (GLvoid *)0);
+        glEnableVertexAttribArray(0);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }));
+    if (s.mode == GL_LINE_STRIP)
+        glLineWidth(10);
+    glDrawArrays(s.mode, 0, static_cast<GLsizei>(s.vertices.size() / 3));
+    glBindVertexArray(0);
+}
+
+int main()
+{
+    auto start = chrono::steady_clock::now();
+    auto elapsedMs = [](chrono::steady_clock::time_point t) {
+        return chrono::duration<double, milli>(chrono::steady_clock::now() - t).count();
+    };
+
+    if (!glfwInit())
+        return -1;
+    regressionInit("Gallery");
+
+    vector<Shape> shapes = makeShapes();
+    if (const char *n = getenv("FCG_GALLERY_WINDOWS"))
+        shapes.resize(min(shapes.size(), static_cast<size_t>(max(atoi(n), 1))));
+
+    WindowGroup group;
+    GLuint prog = 0;
+    GLint colorLoc = -1;
+    for (size_t i = 0; i < shapes.size(); ++i)
+    {
+        auto t = i == 0 ? start : chrono::steady_clock::now();
+        if (!group.open(shapes[i].title, WIN_SIZE, WIN_SIZE))
+        {
+            if (i == 0) { glfwTerminate(); return -1; }
+            shapes.resize(i);
+            break;
+        }
+        glfwSetKeyCallback(group.window(i), key_callback);
+        glfwSetWindowPos(group.window(i), 40 + static_cast<int>(i % 4) * (WIN_SIZE + 10),
+                         40 + static_cast<int>(i / 4) * (WIN_SIZE + 40));
+        if (i == 0)
+        {
+            // Compartilhados: compilados e enviados uma vez só
+            prog = linkProgram(vsSrc, fsSrc, "Gallery");
+            colorLoc = glGetUniformLocation(prog, "inputColor");
+            for (Shape &s : shapes)
+            {
+                glGenBuffers(1, &s.vbo);
+                glBindBuffer(GL_ARRAY_BUFFER, s.vbo);
+                glBufferData(GL_ARRAY_BUFFER, s.vertices.size() * sizeof(GLfloat), s.vertices.data(), GL_STATIC_DRAW);
+            }
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+        }
+        drawShape(group, i, shapes[i], prog, colorLoc);
+        glfwSwapBuffers(group.window(i));
+        cout << "janela " << i + 1 << " (" << shapes[i].title << "): " << elapsedMs(t) << " ms ate o primeiro quadro"
+             << " (janela+contexto " << group.openMs(i) << " ms)" << endl;
+    }
+
+    while (group.running())
+    {
+        glfwPollEvents();
+        for (size_t i = 0; i < group.size(); ++i)
+        {
+            if (!group.begin(i))
+                continue;
+            drawShape(group, i, shapes[i], prog, colorLoc);
+            if (i == 0)
+                regressionFrame(group.window(0));
+            glfwSwapBuffers(group.window(i));
+        }
+    }
+
+    glfwMakeContextCurrent(group.window(0));
+    for (Shape &s : shapes)
+        glDeleteBuffers(1, &s.vbo);
+    glDeleteProgram(prog);
+    group.release();
+    glfwTerminate();
+    return regressionResult();
+}
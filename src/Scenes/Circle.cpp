@@ -0,0 +1,100 @@
+#include "Geometry.h"
+#include "Scene.h"
+
+// Lista1/Exercicio6 como cena: círculo vermelho de 100 segmentos.
+// Teclas + e - mudam o número de segmentos (6a e 6b são 8 e 5).
+
+static const GLchar *vsSrc = R"(
+ #version 400
+ layout (location = 0) in vec3 position;
+ void main()
+ {
+	 gl_Position = vec4(position, 1.0);
+ }
+ )";
+
+static const GLchar *fsSrc = R"(
+ #version 400
+ uniform vec4 inputColor;
+ out vec4 color;
+ void main()
+ {
+	 color = inputColor;
+ }
+ )";
+
+class CircleScene : public Scene
+{
+public:
+    static const int maxSegments = 100;
+
+    const char *name() const override { return "Circulo (Lista1/Exercicio6)"; }
+
+    bool init(SceneContext &ctx) override
+    {
+        program = ctx.programs->get(vsSrc, fsSrc);
+        if (!program)
+            return false;
+        colorLoc = glGetUniformLocation(program, "inputColor");
+
+        glGenBuffers(1, &vbo);
+        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        glBufferData(GL_ARRAY_BUFFER, maxSegments * 9 * sizeof(GLfloat), NULL, GL_DYNAMIC_DRAW);
+        glGenVertexArrays(1, &vao);
+        glBindVertexArray(vao);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(GLfloat), (GLvoid *)0);
+        glEnableVertexAttribArray(0);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindVertexArray(0);
+        upload();
+        return true;
+    }
+
+    void frame(SceneContext &ctx) override
+    {
+        glViewport(0, 0, ctx.width, ctx.height);
+        glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        glUseProgram(program);
+        glUniform4f(colorLoc, 1.0f, 0.0f, 0.0f, 1.0f);
+        glBindVertexArray(vao);
+        glDrawArrays(GL_TRIANGLES, 0, segments * 3);
+        glBindVertexArray(0);
+    }
+
+    void key(int key, int action) override
+    {
+        if (action == GLFW_RELEASE)
+            return;
+        if (key == GLFW_KEY_EQUAL || key == GLFW_KEY_KP_ADD)
+            segments = segments < maxSegments ? segments + 1 : maxSegments;
+        else if (key == GLFW_KEY_MINUS || key == GLFW_KEY_KP_SUBTRACT)
+            segments = segments > 3 ? segments - 1 : 3;
+        else
+            return;
+        upload();
+    }
+
+    void release() override
+    {
+        glDeleteVertexArrays(1, &vao);
+        glDeleteBuffers(1, &vbo);
+        vao = vbo = 0;
+    }
+
+private:
+    void upload()
+    {
+        GLfloat vertices[maxSegments * 9];
+        circleFan(vertices, segments, segments, 0.0f, 0.0f, 0.5f);
+        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, segments * 9 * sizeof(GLfloat), vertices);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    GLuint program = 0, vao = 0, vbo = 0;
+    GLint colorLoc = -1;
+    int segments = maxSegments;
+};
+
+FCG_SCENE(CircleScene)
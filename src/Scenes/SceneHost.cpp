@@ -0,0 +1,254 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <vector>
+
+using namespace std;
+namespace fs = std::filesystem;
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include "GLLoader.h"
+#include "ProgramCache.h"
+#include "Scene.h"
+#include "SharedLibrary.h"
+
+// Host de cenas: uma janela, um contexto e um cache de programas que ficam
+// vivos enquanto as cenas (bibliotecas Scene_*.so/.dll) são trocadas.
+//
+//   SceneHost [Scene_Circle.so Scene_Star.so ...]
+//
+// Sem argumentos, carrega os Scene_* de FCG_SCENES_DIR (padrão: pasta atual).
+// Teclas 1..9 escolhem a cena, R recarrega a atual e ESC sai; as outras vão
+// para a cena. Se o arquivo da cena atual mudar (recompilada), ela é trocada
+// sozinha. A cena nova é carregada e inicializada antes de a antiga sair: se
+// falhar, a antiga continua.
+//
+// FCG_SCENE_SWITCH_FRAMES=n troca de cena a cada n quadros e sai depois de
+// passar duas vezes por todas (a segunda volta mostra o cache quente).
+
+struct ActiveScene
+{
+    unique_ptr<SharedLibrary> lib;
+    Scene *scene = nullptr;
+    FcgDestroySceneFn destroy = nullptr;
+    fs::path copy;              // cópia carregada (o original pode ser sobrescrito)
+    fs::file_time_type stamp;   // data do original quando foi carregado
+};
+
+struct Host
+{
+    vector<fs::path> scenePaths;
+    size_t current = 0;
+    ActiveScene active;
+    ProgramCache programs;
+    SceneContext ctx;
+    GLFWwindow *window = nullptr;
+    long pending = -1; // troca pedida pelo teclado, feita no laço
+};
+
+static Host host;
+
+static bool isSceneLibrary(const fs::path &p)
+{
+    string ext = p.extension().string();
+    return p.filename().string().rfind("Scene_", 0) == 0 && (ext == ".so" || ext == ".dll" || ext == ".dylib");
+}
+
+static vector<fs::path> findScenes(int argc, char **argv)
+{
+    vector<fs::path> paths;
+    for (int i = 1; i < argc; ++i)
+        paths.push_back(argv[i]);
+    if (!paths.empty())
+        return paths;
+    const char *dir = getenv("FCG_SCENES_DIR");
+    error_code ec;
+    for (const fs::directory_entry &e : fs::directory_iterator(dir && *dir ? dir : ".", ec))
+        if (e.is_regular_file() && isSceneLibrary(e.path()))
+            paths.push_back(e.path());
+    sort(paths.begin(), paths.end());
+    return paths;
+}
+
+static void unload(ActiveScene &a)
+{
+    if (a.scene)
+    {
+        a.scene->release();
+        a.destroy(a.scene);
+    }
+    a.scene = nullptr;
+    a.lib.reset();
+    error_code ec;
+    if (!a.copy.empty())
+        fs::remove(a.copy, ec);
+    a.copy.clear();
+}
+
+// Carrega e inicializa a cena `index`; só então descarta a anterior
+static bool activate(size_t index)
+{
+    auto start = chrono::steady_clock::now();
+    const fs::path &path = host.scenePaths[index];
+
+    // Copia antes de abrir: o dlopen do mesmo caminho depois de um dlclose pode
+    // devolver a versão antiga ainda residente, e no Windows a DLL aberta não
+    // pode ser sobrescrita pelo compilador
+    static unsigned counter = 0;
+    error_code ec;
+    ActiveScene next;
+    next.stamp = fs::last_write_time(path, ec);
+    next.copy = fs::temp_directory_path(ec) /
+                ("fcg_" + to_string(chrono::steady_clock::now().time_since_epoch().count()) + "_" +
+                 to_string(counter++) + "_" + path.filename().string());
+    if (!fs::copy_file(path, next.copy, fs::copy_options::overwrite_existing, ec))
+    {
+        cerr << "SceneHost: nao consegui copiar " << path << ": " << ec.message() << endl;
+        return false;
+    }
+
+    next.lib.reset(new SharedLibrary);
+    if (!next.lib->open(next.copy.string()))
+    {
+        cerr << "SceneHost: " << path << ": " << next.lib->error() << endl;
+        unload(next);
+        return false;
+    }
+    auto api = next.lib->symbol<FcgSceneApiFn>("fcgSceneApi");
+    auto create = next.lib->symbol<FcgCreateSceneFn>("fcgCreateScene");
+    next.destroy = next.lib->symbol<FcgDestroySceneFn>("fcgDestroyScene");
+    if (!api || !create || !next.destroy || api() != FCG_SCENE_API)
+    {
+        cerr << "SceneHost: " << path << " nao e uma cena (ou versao diferente da interface)" << endl;
+        unload(next);
+        return false;
+    }
+    double loadMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+    uint64_t missesBefore = host.programs.misses();
+    next.scene = create((GLADloadproc)glfwGetProcAddress);
+    if (!next.scene || !next.scene->init(host.ctx))
+    {
+        cerr << "SceneHost: " << path << " falhou ao inicializar" << endl;
+        unload(next);
+        return false;
+    }
+
+    unload(host.active);
+    host.active = move(next);
+    host.current = index;
+    glfwSetWindowTitle(host.window, host.active.scene->name());
+    double totalMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    cout << "cena " << host.active.scene->name() << ": " << totalMs << " ms (biblioteca " << loadMs
+         << " ms, programas compilados " << host.programs.misses() - missesBefore << ", no cache "
+         << host.programs.size() << ")" << endl;
+    return true;
+}
+
+void key_callback(GLFWwindow *window, int key, int scancode, int action, int mode)
+{
+    if (key == GLFW_KEY_ESCAPE && action == GLFW_PRESS)
+        glfwSetWindowShouldClose(window, GL_TRUE);
+    else if (action == GLFW_PRESS && key >= GLFW_KEY_1 && key <= GLFW_KEY_9 &&
+             static_cast<size_t>(key - GLFW_KEY_1) < host.scenePaths.size())
+        host.pending = key - GLFW_KEY_1;
+    else if (action == GLFW_PRESS && key == GLFW_KEY_R)
+        host.pending = static_cast<long>(host.current);
+    else if (host.active.scene)
+        host.active.scene->key(key, action);
+}
+
+int main(int argc, char **argv)
+{
+    host.scenePaths = findScenes(argc, argv);
+    if (host.scenePaths.empty())
+    {
+        cerr << "SceneHost: nenhuma biblioteca Scene_* encontrada" << endl;
+        return -1;
+    }
+
+    glfwInit();
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
+    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    host.window = glfwCreateWindow(800, 800, "SceneHost", nullptr, nullptr);
+    if (!host.window)
+    {
+        cerr << "Falha ao criar a janela GLFW" << endl;
+        glfwTerminate();
+        return -1;
+    }
+    glfwMakeContextCurrent(host.window);
+    glfwSetKeyCallback(host.window, key_callback);
+    if (!loadGL((GLADloadproc)glfwGetProcAddress))
+    {
+        cerr << "Falha ao inicializar GLAD" << endl;
+        return -1;
+    }
+    host.ctx.programs = &host.programs;
+    glfwGetFramebufferSize(host.window, &host.ctx.width, &host.ctx.height);
+
+    size_t first = 0;
+    while (first < host.scenePaths.size() && !activate(first))
+        ++first;
+    if (!host.active.scene)
+    {
+        glfwTerminate();
+        return -1;
+    }
+
+    const char *switchEnv = getenv("FCG_SCENE_SWITCH_FRAMES");
+    long switchFrames = switchEnv ? atol(switchEnv) : 0;
+    long frame = 0;
+    double prev = glfwGetTime(), nextCheck = prev + 0.5;
+
+    while (!glfwWindowShouldClose(host.window))
+    {
+        glfwPollEvents();
+        double now = glfwGetTime();
+        host.ctx.dt = now - prev;
+        host.ctx.time = now;
+        prev = now;
+
+        // Recompilada? Troca pela versão nova
+        if (now >= nextCheck)
+        {
+            nextCheck = now + 0.5;
+            error_code ec;
+            fs::file_time_type stamp = fs::last_write_time(host.scenePaths[host.current], ec);
+            if (!ec && stamp != host.active.stamp)
+            {
+                if (!activate(host.current))
+                    host.active.stamp = stamp; // não tenta de novo até o arquivo mudar outra vez
+            }
+        }
+        if (switchFrames > 0 && ++frame % switchFrames == 0)
+        {
+            if (frame / switchFrames >= 2 * static_cast<long>(host.scenePaths.size()))
+                glfwSetWindowShouldClose(host.window, GL_TRUE);
+            host.pending = static_cast<long>((host.current + 1) % host.scenePaths.size());
+        }
+        if (host.pending >= 0)
+        {
+            activate(static_cast<size_t>(host.pending));
+            host.pending = -1;
+        }
+
+        glfwGetFramebufferSize(host.window, &host.ctx.width, &host.ctx.height);
+        host.active.scene->frame(host.ctx);
+        glfwSwapBuffers(host.window);
+    }
+
+    unload(host.active);
+    host.programs.release();
+    glfwTerminate();
+    return 0;
+}
@@ -0,0 +1,101 @@
+#include "Geometry.h"
+#include "Scene.h"
+
+// Lista1/Exercicio7 como cena: espiral de Arquimedes em GL_LINE_STRIP. Setas
+// para cima/baixo mudam o passo b de r = a + b*theta.
+
+static const GLchar *vsSrc = R"(
+ #version 400
+ layout (location = 0) in vec3 position;
+ void main()
+ {
+	 gl_Position = vec4(position, 1.0);
+ }
+ )";
+
+static const GLchar *fsSrc = R"(
+ #version 400
+ uniform vec4 inputColor;
+ out vec4 color;
+ void main()
+ {
+	 color = inputColor;
+ }
+ )";
+
+class SpiralScene : public Scene
+{
+public:
+    static const int segments = 190;
+
+    const char *name() const override { return "Espiral (Lista1/Exercicio7)"; }
+
+    bool init(SceneContext &ctx) override
+    {
+        program = ctx.programs->get(vsSrc, fsSrc);
+        if (!program)
+            return false;
+        colorLoc = glGetUniformLocation(program, "inputColor");
+
+        glGenBuffers(1, &vbo);
+        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        glBufferData(GL_ARRAY_BUFFER, segments * 3 * sizeof(GLfloat), NULL, GL_DYNAMIC_DRAW);
+        glGenVertexArrays(1, &vao);
+        glBindVertexArray(vao);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(GLfloat), (GLvoid *)0);
+        glEnableVertexAttribArray(0);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindVertexArray(0);
+        upload();
+        return true;
+    }
+
+    void frame(SceneContext &ctx) override
+    {
+        glViewport(0, 0, ctx.width, ctx.height);
+        glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        glLineWidth(10);
+        glUseProgram(program);
+        glUniform4f(colorLoc, 1.0f, 0.0f, 0.0f, 1.0f);
+        glBindVertexArray(vao);
+        glDrawArrays(GL_LINE_STRIP, 0, segments);
+        glBindVertexArray(0);
+    }
+
+    void key(int key, int action) override
+    {
+        if (action == GLFW_RELEASE)
+            return;
+        if (key == GLFW_KEY_UP)
+            b += 0.002f;
+        else if (key == GLFW_KEY_DOWN && b > 0.004f)
+            b -= 0.002f;
+        else
+            return;
+        upload();
+    }
+
+    void release() override
+    {
+        glDeleteVertexArrays(1, &vao);
+        glDeleteBuffers(1, &vbo);
+        vao = vbo = 0;
+    }
+
+private:
+    void upload()
+    {
+        GLfloat vertices[segments * 3];
+        spiral(vertices, segments, 0.0f, 0.0f, 0.0f, b, 0.1f);
+        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    GLuint program = 0, vao = 0, vbo = 0;
+    GLint colorLoc = -1;
+    float b = 0.02f;
+};
+
+FCG_SCENE(SpiralScene)
@@ -0,0 +1,103 @@
+#include <cmath>
+
+#include "Geometry.h"
+#include "Scene.h"
+
+// Lista1/Exercicio6e como cena: estrela de 5 pontas. Setas esquerda/direita
+// giram a estrela (a geometria é refeita no VBO).
+
+static const GLchar *vsSrc = R"(
+ #version 400
+ layout (location = 0) in vec3 position;
+ void main()
+ {
+	 gl_Position = vec4(position, 1.0);
+ }
+ )";
+
+static const GLchar *fsSrc = R"(
+ #version 400
+ uniform vec4 inputColor;
+ out vec4 color;
+ void main()
+ {
+	 color = inputColor;
+ }
+ )";
+
+class StarScene : public Scene
+{
+public:
+    static const int segments = 5;
+
+    const char *name() const override { return "Estrela (Lista1/Exercicio6e)"; }
+
+    bool init(SceneContext &ctx) override
+    {
+        // Mesmo par de shaders do círculo: acerto no cache do host
+        program = ctx.programs->get(vsSrc, fsSrc);
+        if (!program)
+            return false;
+        colorLoc = glGetUniformLocation(program, "inputColor");
+
+        glGenBuffers(1, &vbo);
+        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        glBufferData(GL_ARRAY_BUFFER, segments * 18 * sizeof(GLfloat), NULL, GL_DYNAMIC_DRAW);
+        glGenVertexArrays(1, &vao);
+        glBindVertexArray(vao);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(GLfloat), (GLvoid *)0);
+        glEnableVertexAttribArray(0);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindVertexArray(0);
+        upload();
+        return true;
+    }
+
+    void frame(SceneContext &ctx) override
+    {
+        glViewport(0, 0, ctx.width, ctx.height);
+        glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        glUseProgram(program);
+        glUniform4f(colorLoc, 1.0f, 0.0f, 0.0f, 1.0f);
+        glBindVertexArray(vao);
+        glDrawArrays(GL_TRIANGLES, 0, segments * 3 * 2);
+        glBindVertexArray(0);
+    }
+
+    void key(int key, int action) override
+    {
+        if (action == GLFW_RELEASE)
+            return;
+        if (key == GLFW_KEY_LEFT)
+            angle += 0.1;
+        else if (key == GLFW_KEY_RIGHT)
+            angle -= 0.1;
+        else
+            return;
+        upload();
+    }
+
+    void release() override
+    {
+        glDeleteVertexArrays(1, &vao);
+        glDeleteBuffers(1, &vbo);
+        vao = vbo = 0;
+    }
+
+private:
+    void upload()
+    {
+        GLfloat vertices[segments * 18];
+        starFan(vertices, segments, 0.0f, 0.0f, 0.5f, 0.18f, angle);
+        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    GLuint program = 0, vao = 0, vbo = 0;
+    GLint colorLoc = -1;
+    double angle = 4.08;
+};
+
+FCG_SCENE(StarScene)
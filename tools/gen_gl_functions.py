@@ -0,0 +1,49 @@
+#!/usr/bin/env python3
+"""Gera Common/GLFunctions.h com as funções OpenGL que o projeto realmente usa.
+
+Procura chamadas gl*(...) nos fontes de src/ e nos cabeçalhos de Common/ e
+escreve uma lista X-macro usada pelo carregador mínimo (Common/GLLoader.h).
+Rodar de novo sempre que um programa passar a usar uma função nova:
+
+    python3 tools/gen_gl_functions.py
+"""
+import pathlib
+import re
+
+ROOT = pathlib.Path(__file__).resolve().parent.parent
+GLAD_H = ROOT / "include" / "glad" / "glad.h"
+OUTPUT = ROOT / "Common" / "GLFunctions.h"
+
+CALL = re.compile(r"\b(gl[A-Z][A-Za-z0-9_]*)\s*\(")
+DEFINE = re.compile(r"^#define (gl[A-Z]\w*) glad_\1$", re.M)
+
+
+def sources():
+    for path in sorted((ROOT / "src").rglob("*.cpp")):
+        yield path
+    for path in sorted((ROOT / "Common").glob("*.h")):
+        if path.name not in ("GLFunctions.h",):
+            yield path
+
+
+def main():
+    available = set(DEFINE.findall(GLAD_H.read_text(encoding="utf-8")))
+    used = set()
+    for path in sources():
+        text = path.read_text(encoding="utf-8", errors="replace")
+        used.update(name for name in CALL.findall(text) if name in available)
+    used.add("glGetString")  # necessária para descobrir a versão
+
+    lines = [
+        "// Gerado por tools/gen_gl_functions.py -- não editar à mão.",
+        "// Funções OpenGL referenciadas pelo projeto (%d de %d da GLAD)." % (len(used), len(available)),
+        "",
+    ]
+    for name in sorted(used):
+        lines.append("GL_FUNCTION(PFN%sPROC, %s)" % (name.upper(), name))
+    OUTPUT.write_text("\n".join(lines) + "\n", encoding="utf-8")
+    print("%s: %d funções" % (OUTPUT.relative_to(ROOT), len(used)))
+
+
+if __name__ == "__main__":
+    main()